@@ -10,9 +10,14 @@
 #include <string.h>
 #include <stdbool.h>
 #include <assert.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <time.h>
 
 /* LLVM Header Files */
 #include "llvm-c/Core.h"
+#include "llvm-c/Target.h"
 #include "dominance.h"
 
 /* Header file global to this project */
@@ -20,76 +25,375 @@
 #include "loop.h"
 #include "worklist.h"
 #include "valmap.h"
+#include "irflags.h"
 
-static LLVMBuilderRef Builder;
-int stats[6] = {0};
+#define MAX_LANES 16
+
+static int VectorBits = 256;//target vector register width, from the cost target or SLP_VECTOR_BITS
+static int MaxRounds = 16;//analysis rounds per block at most, from SLP_MAX_ROUNDS
+static int MaxTreeDepth = 32;//packs from the root to a leaf at most, from SLP_MAX_TREE_DEPTH
+static int MaxTreeNodes = 1024;//packs in one tree at most, from SLP_MAX_TREE_NODES
+static int BlockPacks = 64;//packs built per instruction of a block at most, from SLP_BLOCK_PACKS
+static double HotThreshold = 1;//blocks that run less often are skipped, from SLP_HOT_THRESHOLD
+//the time budgets are off unless set, the blocks they leave out depend on
+//the speed of the machine and on how the workers are scheduled
+static double FunctionBudget;//seconds per function, 0 for no limit, from SLP_FUNCTION_BUDGET_MS
+static double ModuleBudget;//seconds for the module, 0 for no limit, from SLP_MODULE_BUDGET_MS
+static struct timespec ModuleStart;
+static LLVMTargetDataRef TD;//data layout of the module, for type sizes and field offsets
 
 
 typedef struct VectorPairDef {
-  LLVMValueRef pair[2];//holds isomorphic insts
+  LLVMValueRef pair[MAX_LANES];//holds isomorphic insts, pair[k] goes to lane k
+  int lanes;//number of lanes in use
+  int first;//lane that comes first in the BB
   int insertAt0;
+  LLVMValueRef at;//instruction the vector instruction is built before, set by IsTransformable
+  unsigned swapped;//lanes whose two operands are read in reverse order, bit k for lane k
+  int bits;//integer width the pack is computed in when narrower than its own, else 0
+  int depth;//packs between this one and the root of its tree
+  int cursor;//next operand CollectIsomorphicInsts looks at
+  int subtree;//score of this pack and the packs kept below it, set by TrimTree
+  struct VectorPairDef *parent;//pack whose operand this one is, NULL for the root
   struct VectorPairDef *next;
   struct VectorPairDef *prev;
 } VectorPair;
 
 //list contains a list of vector pairs added using add pair
 //list form is operands->operands->iso pair
+//packs and lists are bump allocated from the chunks of the block being
+//vectorized, which all go back at once when the block is done
+#define ARENA_BYTES 8192
+
+typedef struct ArenaChunkDef {
+  struct ArenaChunkDef *next;
+  size_t used;//bytes of data handed out
+  long data[ARENA_BYTES/sizeof(long)];
+} ArenaChunk;
+
 typedef struct  {
   VectorPair *head;
   VectorPair *tail;
-  valmap_t    visited;//instructions already added in one of the pairs
-  valmap_t    sliceA;
+  valmap_t    visited;//instructions already added in one of the pairs, mapped to their pack
   int size;  
   int score;
+  int trimmed;//packs cut off the tree it was copied from
 } VectorList;
 
+typedef struct {
+  valmap_t ord;//instruction -> ordinal, for the instructions of numbered blocks
+  valmap_t valid;//blocks whose ordinals are up to date
+} BlockOrder;
+
+typedef struct {
+  LLVMValueRef I;
+  unsigned long *bits;//NULL when not computed or invalidated
+  int len;//number of words in bits
+} SliceEntry;
+
+typedef struct {
+  LLVMBasicBlockRef BB;
+  valmap_t idx;//instruction -> dense index+1
+  SliceEntry *slices;//indexed by dense index
+  int count;
+  int cap;
+  unsigned long *erased;//dense indices erased since the last invalidate
+  int erasedLen;
+} DepInfo;
+
+//vectors gathered in the current block, so that a later pack can read the
+//lanes it needs from them instead of gathering the scalars once more
+typedef struct {
+  valmap_t vec;//scalar -> vector it was gathered into
+  valmap_t lane;//scalar -> its lane in that vector+1
+  valmap_t live;//gathered vectors that have not been erased since
+} VectorRegistry;
+
+//look-ahead scores of operand pairs, valid for one tree build
+#define LOOKAHEAD_CACHE 1024
+
+typedef struct {
+  LLVMValueRef a, b;
+  int depth;
+  int score;
+  unsigned build;//tree build the score was found in
+} LookAheadEntry;
+
+//compile time profile of the pass, only built with -DSLP_PROFILE (make
+//PROFILE=1); SLP_STATS=table|json picks the report, SLP_STATS_FILE where
+//it goes. json goes to stderr by default, away from the text on stdout
+enum { PHASE_OTHER, PHASE_SEED, PHASE_COLLECT, PHASE_SCORE, PHASE_TRANSFORM, PHASE_VECTORIZE, NUM_PHASES };
+enum { CNT_PAIRS, CNT_TREES, CNT_REJ_SHOULD, CNT_REJ_SIZE, CNT_REJ_SCORE, CNT_REJ_TRANSFORM,
+       CNT_VECTORIZED, CNT_SAVED, NUM_COUNTERS };
+
+#ifdef SLP_PROFILE
+typedef struct {
+  double seconds[NUM_PHASES];//time spent in each phase, nested phases excluded
+  long counters[NUM_COUNTERS];
+  int stack[16];//phases entered and not left yet
+  int depth;
+  struct timespec last;//when the phase on top of the stack was last charged
+} Profile;
+
+#define PROF_ENTER(p) profSwitch(p)
+#define PROF_LEAVE() profSwitch(-1)
+#define PROF_COUNT(c) (Ctx->prof.counters[c]++)
+#define PROF_ADD(c,n) (Ctx->prof.counters[c] += (n))
+#else
+#define PROF_ENTER(p) ((void)0)
+#define PROF_LEAVE() ((void)0)
+#define PROF_COUNT(c) ((void)0)
+#define PROF_ADD(c,n) ((void)0)
+#endif
+
+//everything one worker mutates while it runs SLPOnFunction,
+//the statistics are summed over the workers at the end
+typedef struct {
+  LLVMBuilderRef Builder;
+  BlockOrder Order;
+  DepInfo Dep;
+  VectorRegistry Reg;
+  valmap_t Loops;//header of each loop that is a single block -> its preheader
+  LookAheadEntry *look;//LOOKAHEAD_CACHE entries, by hash of the pair
+  unsigned build;//current tree build, older entries of look are stale
+  FILE *log;//printList output of the current function, printed in module order
+  int stats[6];
+  int widthStats[MAX_LANES+1];//vectorized lists by number of lanes
+  long seedPairs;//candidate pairs examined while seeding
+  long unprofitable;//best lists the cost model rejected
+  long reductions;//reduction trees replaced by a vector reduction
+  long coldBlocks;//blocks below HotThreshold, not looked at
+  long budgetBlocks;//blocks left alone because the time budget ran out
+  long packsLeft;//packs the trees of the current block may still be built from
+  long cutBlocks;//blocks whose seeding stopped when packsLeft ran out
+  long trimmed;//packs cut off vectorized trees
+  long fused;//fmul and fadd packs built as one vector fma
+  struct timespec started;//when the current function was started
+  ArenaChunk *blockArena;//chunks the lists of the current block live in, newest first
+  ArenaChunk *freeChunks;//chunks of finished blocks, ready for reuse
+  valmap_t *freeMaps;//cleared valmaps of destroyed lists
+  int numFreeMaps;
+  int capFreeMaps;
+  long allocs;//lists, pairs and valmaps handed out
+  long mallocs;//of those, the ones that had to come from malloc
+#ifdef SLP_PROFILE
+  Profile prof;
+#endif
+} SLPContext;
+
+//context of the worker running on this thread
+static __thread SLPContext *Ctx;
+
+//the module, its constants and types are shared by all workers: IR is only
+//changed with ModuleLock held, analysis of a function runs unlocked
+static pthread_mutex_t ModuleLock = PTHREAD_MUTEX_INITIALIZER;
+//the data layout computes struct layouts on first use and caches them
+static pthread_mutex_t LayoutLock = PTHREAD_MUTEX_INITIALIZER;
+
+#ifdef SLP_PROFILE
+//charge the time since the last switch to the current phase, then enter
+//phase p (p >= 0) or go back to the enclosing one (p < 0)
+static void profSwitch(int p)
+{
+  Profile *P = &Ctx->prof;
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC,&now);
+  if(P->depth > 0)
+    P->seconds[P->stack[P->depth-1]] += (now.tv_sec-P->last.tv_sec) + 1e-9*(now.tv_nsec-P->last.tv_nsec);
+  P->last = now;
+  if(p >= 0) {
+    assert(P->depth < 16);
+    P->stack[P->depth++] = p;
+  } else {
+    P->depth--;
+  }
+}
+#endif
+
+static void *arenaAlloc(ArenaChunk **arena, size_t bytes)
+{
+  ArenaChunk *chunk = *arena;
+  void *p;
+  bytes = (bytes + sizeof(long) - 1) & ~(sizeof(long) - 1);
+  assert(bytes <= ARENA_BYTES);
+  Ctx->allocs++;
+  if(chunk == NULL || chunk->used + bytes > ARENA_BYTES) {
+    chunk = Ctx->freeChunks;
+    if(chunk)
+      Ctx->freeChunks = chunk->next;
+    else {
+      chunk = (ArenaChunk*) malloc(sizeof(ArenaChunk));
+      Ctx->mallocs++;
+    }
+    chunk->used = 0;
+    chunk->next = *arena;
+    *arena = chunk;
+  }
+  p = (char*)chunk->data + chunk->used;
+  chunk->used += bytes;
+  return p;
+}
+
+//the lists of the block are all destroyed, take back their chunks
+static void arenaReset()
+{
+  ArenaChunk *chunk;
+  while((chunk = Ctx->blockArena) != NULL) {
+    Ctx->blockArena = chunk->next;
+    chunk->next = Ctx->freeChunks;
+    Ctx->freeChunks = chunk;
+  }
+}
+
+static valmap_t poolMap()
+{
+  Ctx->allocs++;
+  if(Ctx->numFreeMaps > 0)
+    return Ctx->freeMaps[--Ctx->numFreeMaps];
+  Ctx->mallocs++;
+  return valmap_create();
+}
+
+static void poolMapRelease(valmap_t map)
+{
+  if(Ctx->numFreeMaps == Ctx->capFreeMaps) {
+    Ctx->capFreeMaps = Ctx->capFreeMaps ? 2*Ctx->capFreeMaps : 16;
+    Ctx->freeMaps = (valmap_t*) realloc(Ctx->freeMaps,Ctx->capFreeMaps*sizeof(valmap_t));
+  }
+  valmap_clear(map);
+  Ctx->freeMaps[Ctx->numFreeMaps++] = map;
+}
+
+//free what the pools of the current worker hold
+static void poolDestroy()
+{
+  ArenaChunk *chunk;
+  while((chunk = Ctx->freeChunks) != NULL) {
+    Ctx->freeChunks = chunk->next;
+    free(chunk);
+  }
+  while(Ctx->numFreeMaps > 0)
+    valmap_destroy(Ctx->freeMaps[--Ctx->numFreeMaps]);
+  free(Ctx->freeMaps);
+  Ctx->freeMaps = NULL;
+  Ctx->capFreeMaps = 0;
+  free(Ctx->look);
+  Ctx->look = NULL;
+}
+
 static VectorList* create() {
-  VectorList *new = (VectorList*) malloc(sizeof(VectorList));
+  VectorList *new = (VectorList*) arenaAlloc(&Ctx->blockArena,sizeof(VectorList));
   new->head = NULL;//no pairs
   new->tail = NULL;
-  new->visited = valmap_create();
-  new->sliceA = valmap_create();
+  new->visited = poolMap();
   new->size=0;
+  new->trimmed=0;
   return new;
 }
 
-//destroy vector list
+//destroy vector list, the list and its pairs stay in the block arena
+//until arenaReset
 static void destroy(VectorList *list)
 {
   if(list == NULL){
 	return;  
 	}
-  valmap_destroy(list->visited);
-  valmap_destroy(list->sliceA);
-  VectorPair *head = list->head;
-  VectorPair *tmp;
-  while(head) {
-    tmp = head;
-    head=head->next;
-    free(tmp);    
+  poolMapRelease(list->visited);
+}
+
+//per block instruction ordering
+//every instruction of the block gets an ordinal once, so that
+//"which one comes first" is a compare instead of a walk to the end of the BB
+#define ORDER_GAP 1024
+
+//number every instruction in BB leaving a gap between neighbours. each
+//block keeps its numbers, so queries that go back and forth between blocks
+//do not number them again
+static void orderRenumber(LLVMBasicBlockRef BB)
+{
+  LLVMValueRef I;
+  long n = 0;
+  if(Ctx->Order.ord == NULL) {
+    Ctx->Order.ord = valmap_create();
+    Ctx->Order.valid = valmap_create();
+  }
+  valmap_insert(Ctx->Order.valid,LLVMBasicBlockAsValue(BB),(void*)1);
+  for(I=LLVMGetFirstInstruction(BB);I!=NULL;I=LLVMGetNextInstruction(I)) {
+    n += ORDER_GAP;
+    valmap_insert(Ctx->Order.ord,I,(void*)n);
+  }
+}
+
+//instructions of BB were moved, number it again when it is next asked about
+static void orderInvalidate(LLVMBasicBlockRef BB)
+{
+  if(Ctx->Order.valid)
+    valmap_remove(Ctx->Order.valid,LLVMBasicBlockAsValue(BB));
+}
+
+static void orderDestroy()
+{
+  if(Ctx->Order.ord) {
+    valmap_destroy(Ctx->Order.ord);
+    valmap_destroy(Ctx->Order.valid);
+  }
+  Ctx->Order.ord = NULL;
+  Ctx->Order.valid = NULL;
+}
+
+//forget an instruction before it is erased so that its address can not
+//come back later with a stale ordinal
+static void orderErase(LLVMValueRef I)
+{
+  if(Ctx->Order.ord)
+    valmap_remove(Ctx->Order.ord,I);
+}
+
+static long ordinal(LLVMValueRef I)
+{
+  LLVMValueRef P,N;
+  long lo,hi;
+  LLVMBasicBlockRef BB = LLVMGetInstructionParent(I);
+  if(Ctx->Order.ord==NULL || !valmap_check(Ctx->Order.valid,LLVMBasicBlockAsValue(BB))) {
+    orderRenumber(BB);
+  }
+  if(valmap_check(Ctx->Order.ord,I))
+    return (long)valmap_find(Ctx->Order.ord,I);
+
+  //I was inserted after numbering: put it in the gap between its
+  //neighbours, renumber the block only when the gap is used up
+  P = LLVMGetPreviousInstruction(I);
+  N = LLVMGetNextInstruction(I);
+  lo = (P && valmap_check(Ctx->Order.ord,P)) ? (long)valmap_find(Ctx->Order.ord,P) : -1;
+  hi = (N && valmap_check(Ctx->Order.ord,N)) ? (long)valmap_find(Ctx->Order.ord,N) : -1;
+  if(P==NULL)
+    lo = 0;
+  if(N==NULL && lo>=0)
+    hi = lo + 2*ORDER_GAP;
+  if(lo>=0 && hi>lo+1) {
+    valmap_insert(Ctx->Order.ord,I,(void*)(lo+(hi-lo)/2));
+  } else {
+    orderRenumber(BB);
   }
-  free(list);
-  list = NULL;
+  return (long)valmap_find(Ctx->Order.ord,I);
 }
 
 static int dom(LLVMValueRef a, LLVMValueRef b)
 {
   if (LLVMGetInstructionParent(a)!=LLVMGetInstructionParent(b)) {
     LLVMValueRef fun = LLVMGetBasicBlockParent(LLVMGetInstructionParent(a));
-    // a dom b?
-    return LLVMDominates(fun,LLVMGetInstructionParent(a),
+    int r;
+    // a dom b? (the dominance helpers are not known to be reentrant)
+    pthread_mutex_lock(&ModuleLock);
+    r = LLVMDominates(fun,LLVMGetInstructionParent(a),
 			 LLVMGetInstructionParent(b));
+    pthread_mutex_unlock(&ModuleLock);
+    return r;
   }
 
   // a and b must be in same block
   // which one comes first?
-  LLVMValueRef t = a;
-  while(t!=NULL) {
-    if (t==b)
-      return 1;
-    t = LLVMGetNextInstruction(t);
-  }
-  return 0;
+  return ordinal(a) <= ordinal(b);
 }
 
 static int dominBB(LLVMValueRef a, LLVMValueRef b)
@@ -101,25 +405,31 @@ static int dominBB(LLVMValueRef a, LLVMValueRef b)
 
   // a and b must be in same block
   // which one comes first?
-  LLVMValueRef t = a;
-  while(t!=NULL) {
-    if (t==b)
-      return 1;
-    t = LLVMGetNextInstruction(t);
-  }
-  return 0;
+  return ordinal(a) <= ordinal(b);
 }
 
-//inserts a pair into vector list
-static VectorPair *addPair(VectorList *list, LLVMValueRef a, LLVMValueRef b)
+//inserts a pack of n lanes into vector list
+//lanes are kept in the given order so that lane k of an operand pack
+//feeds lane k of its user
+static VectorPair *addPair(VectorList *list, LLVMValueRef *lanes, int n)
 {
-  VectorPair *new = (VectorPair*) malloc(sizeof(VectorPair));
-  new->pair[0] = a;
-  new->pair[1] = b;
+  VectorPair *new = (VectorPair*) arenaAlloc(&Ctx->blockArena,sizeof(VectorPair));
+  int k;
+  new->lanes = n;
+  new->first = 0;
+  for(k=0;k<n;k++) {
+    new->pair[k] = lanes[k];
+    valmap_insert(list->visited,lanes[k],(void*)new);
+    if(!dominBB(new->pair[new->first],lanes[k]))
+      new->first = k;
+  }
 
   new->insertAt0 = 1;
-  valmap_insert(list->visited,a,(void*)1);
-  valmap_insert(list->visited,b,(void*)1);
+  new->swapped = 0;
+  new->bits = 0;
+  new->depth = 0;
+  new->cursor = 0;
+  new->parent = NULL;
   new->next = NULL;
   new->prev = NULL;
   // empty list so
@@ -132,8 +442,8 @@ static VectorPair *addPair(VectorList *list, LLVMValueRef a, LLVMValueRef b)
     VectorPair *temp = list->head;
     VectorPair *prev = NULL;
 
-	//insert after the last instruction that dominates a (it is assumed that a dominates b)
-    while(temp && dom(temp->pair[0],a)) {
+	//insert after the last pack whose first lane dominates our first lane
+    while(temp && dom(temp->pair[temp->first],new->pair[new->first])) {
       prev=temp;
       temp=temp->next;   
     }
@@ -156,32 +466,223 @@ static VectorPair *addPair(VectorList *list, LLVMValueRef a, LLVMValueRef b)
   return new;
 }
 
-// put a and b into a vector
-static LLVMValueRef assembleVec2(LLVMValueRef a, LLVMValueRef b)
+// put lanes into a vector, lanes[k] goes to element k
+// constants go into the initial vector, one value in every lane is a splat
+static LLVMValueRef assembleVec(LLVMValueRef *lanes, int n)
 {
-  LLVMTypeRef type = LLVMTypeOf(a);
-  LLVMValueRef ret;
+  LLVMTypeRef type = LLVMTypeOf(lanes[0]);
+  LLVMValueRef ret, base[MAX_LANES];
+  int k, allConst = 1, splat = 1;
+
+  for (k=0;k<n;k++) {
+    if (!LLVMIsAConstant(lanes[k]))
+      allConst = 0;
+    if (lanes[k] != lanes[0])
+      splat = 0;
+  }
 
-  if (LLVMIsAConstant(a) && LLVMIsAConstant(b)) {
+  if (allConst) {
     // Build constant vector
-    LLVMValueRef vec[2] = {a,b};
-    ret = LLVMConstVector(vec,2);        
-  }  else {
-    // Build vector of size 2 and type same as a
-    LLVMTypeRef vtype = LLVMVectorType(type,2);
-    LLVMValueRef c = LLVMConstNull(vtype);
-    
-	//insert first element
-    ret = LLVMBuildInsertElement(Builder,c,a,
+    ret = LLVMConstVector(lanes,n);        
+  } else if (splat) {
+    // one insert, then broadcast element 0
+    ret = LLVMBuildInsertElement(Ctx->Builder,LLVMGetUndef(LLVMVectorType(type,n)),lanes[0],
 				 LLVMConstInt(LLVMInt32Type(),0,0),"v.ie");
-	//insert second element
-    ret = LLVMBuildInsertElement(Builder,ret,b,
-				 LLVMConstInt(LLVMInt32Type(),1,0),"v.ie");    
+    ret = LLVMBuildShuffleVector(Ctx->Builder,ret,LLVMGetUndef(LLVMTypeOf(ret)),
+				 LLVMConstNull(LLVMVectorType(LLVMInt32Type(),n)),"v.splat");
+  } else {
+    // start from the constant lanes and insert the others
+    for (k=0;k<n;k++)
+      base[k] = LLVMIsAConstant(lanes[k]) ? lanes[k] : LLVMGetUndef(type);
+    ret = LLVMConstVector(base,n);
+    
+    for (k=0;k<n;k++)
+      if (!LLVMIsAConstant(lanes[k]))
+        ret = LLVMBuildInsertElement(Ctx->Builder,ret,lanes[k],
+				     LLVMConstInt(LLVMInt32Type(),k,0),"v.ie");
   }
 
   return ret;
 }
 
+static int PointerOperand(LLVMValueRef I)
+{
+	if(LLVMIsALoadInst(I)){
+		return 0;
+	}
+	if(LLVMIsAStoreInst(I)){
+		return 1;
+	}
+	return -1;
+}
+
+//index of the called function among the operands of a call, -1 for others
+static int CalleeOperand(LLVMValueRef I)
+{
+	return LLVMIsACallInst(I) ? LLVMGetNumOperands(I)-1 : -1;
+}
+
+//the opcode that may share a pack with op: such lanes become one vector
+//operation of each opcode and a blend of the two, 0 when there is none
+static LLVMOpcode AltOpcode(LLVMOpcode op)
+{
+	switch(op){
+		case LLVMAdd:
+			return LLVMSub;
+		case LLVMSub:
+			return LLVMAdd;
+		case LLVMFAdd:
+			return LLVMFSub;
+		case LLVMFSub:
+			return LLVMFAdd;
+		default:
+			return (LLVMOpcode)0;
+	}
+}
+
+//first lane of the pack whose opcode is not the one of lane 0, NULL if none
+static LLVMValueRef AltLane(VectorPair *ptr)
+{
+	int k;
+	for(k=1;k<ptr->lanes;k++){
+		if(LLVMGetInstructionOpcode(ptr->pair[k]) != LLVMGetInstructionOpcode(ptr->pair[0])){
+			return ptr->pair[k];
+		}
+	}
+	return NULL;
+}
+
+//a call to a pure math function becomes one call of its vector form. lanes 0
+//is an overloaded intrinsic that exists at every width, otherwise the vector
+//function takes exactly that many lanes; cost is one call of it
+typedef struct {
+	char scalar[64];
+	char vector[64];
+	int lanes;
+	int cost;
+} MathEntry;
+
+#define MAX_MATH_ARGS 3
+
+//what the targets do natively, libm names only when the call can not set errno
+static const MathEntry MathBuiltins[] = {
+	{"llvm.sqrt","llvm.sqrt",0,6}, {"sqrt","llvm.sqrt",0,6}, {"sqrtf","llvm.sqrt",0,6},
+	{"llvm.fabs","llvm.fabs",0,1}, {"fabs","llvm.fabs",0,1}, {"fabsf","llvm.fabs",0,1},
+	{"llvm.copysign","llvm.copysign",0,1}, {"copysign","llvm.copysign",0,1}, {"copysignf","llvm.copysign",0,1},
+	{"llvm.floor","llvm.floor",0,1}, {"floor","llvm.floor",0,1}, {"floorf","llvm.floor",0,1},
+	{"llvm.ceil","llvm.ceil",0,1}, {"ceil","llvm.ceil",0,1}, {"ceilf","llvm.ceil",0,1},
+	{"llvm.trunc","llvm.trunc",0,1}, {"trunc","llvm.trunc",0,1}, {"truncf","llvm.trunc",0,1},
+	{"llvm.rint","llvm.rint",0,1}, {"rint","llvm.rint",0,1}, {"rintf","llvm.rint",0,1},
+	{"llvm.nearbyint","llvm.nearbyint",0,1}, {"nearbyint","llvm.nearbyint",0,1}, {"nearbyintf","llvm.nearbyint",0,1},
+	{"llvm.minnum","llvm.minnum",0,1}, {"fmin","llvm.minnum",0,1}, {"fminf","llvm.minnum",0,1},
+	{"llvm.maxnum","llvm.maxnum",0,1}, {"fmax","llvm.maxnum",0,1}, {"fmaxf","llvm.maxnum",0,1},
+	{"llvm.fma","llvm.fma",0,1}, {"fma","llvm.fma",0,1}, {"fmaf","llvm.fma",0,1},
+	{"llvm.fmuladd","llvm.fmuladd",0,1},
+	{"","",0,0}
+};
+
+//entries of SLP_MATH_TABLE, they take precedence over the builtins
+static MathEntry *MathLoaded;
+static int MathLoadedCount;
+static unsigned MathReadNone;//attribute kind of readnone
+
+//the function I calls when it is a call with no side effects
+static LLVMValueRef PureCallee(LLVMValueRef I)
+{
+	LLVMValueRef F;
+	if(!LLVMIsACallInst(I) || !LLVMIsAFunction(F = LLVMGetCalledValue(I))){
+		return NULL;
+	}
+	if(LLVMGetEnumAttributeAtIndex(F,LLVMAttributeFunctionIndex,MathReadNone) == NULL &&
+	   LLVMGetCallSiteEnumAttribute(I,LLVMAttributeFunctionIndex,MathReadNone) == NULL){
+		return NULL;
+	}
+	return F;
+}
+
+//the entry for call I at n lanes, at any width when n is 0. the arguments
+//and the result must all be one float type
+static const MathEntry *MathLookup(LLVMValueRef I, int n)
+{
+	LLVMValueRef F = PureCallee(I);
+	LLVMTypeKind kind;
+	const MathEntry *M;
+	char name[64];
+	const char *s;
+	size_t len;
+	int i;
+	if(F == NULL || LLVMGetNumArgOperands(I) > MAX_MATH_ARGS){
+		return NULL;
+	}
+	kind = LLVMGetTypeKind(LLVMTypeOf(I));
+	if(kind != LLVMFloatTypeKind && kind != LLVMDoubleTypeKind){
+		return NULL;
+	}
+	for(i=0;i<(int)LLVMGetNumArgOperands(I);i++){
+		if(LLVMTypeOf(LLVMGetOperand(I,i)) != LLVMTypeOf(I)){
+			return NULL;
+		}
+	}
+	//an intrinsic is known without its type suffix
+	s = LLVMGetValueName2(F,&len);
+	if(LLVMGetIntrinsicID(F) && strrchr(s,'.') != NULL){
+		len = strrchr(s,'.') - s;
+	}
+	if(len >= sizeof(name)){
+		return NULL;
+	}
+	memcpy(name,s,len);
+	name[len] = '\0';
+	for(i=MathLoadedCount-1;i>=0;i--){
+		M = &MathLoaded[i];
+		if(strcmp(M->scalar,name) == 0 && (n == 0 || M->lanes == 0 || M->lanes == n)){
+			return M;
+		}
+	}
+	for(M=MathBuiltins;M->scalar[0]!='\0';M++){
+		if(strcmp(M->scalar,name) == 0){
+			return M;
+		}
+	}
+	return NULL;
+}
+
+//read vector forms of math calls, one per line ('#' starts a comment):
+//  <scalar function> <vector function> <lanes> [cost]
+//lanes 0 names an overloaded intrinsic, the cost defaults to that of a call
+static void mathLoadTable(const char *path, int defaultCost)
+{
+	FILE *fp = fopen(path,"r");
+	char line[256], *hash;
+	MathEntry M;
+	int n, lineNo = 0, cap = 0;
+	if(fp == NULL){
+		fprintf(stderr,"SLP: cannot open math table %s\n",path);
+		return;
+	}
+	while(fgets(line,sizeof(line),fp)){
+		lineNo++;
+		if((hash = strchr(line,'#')) != NULL){
+			*hash = '\0';
+		}
+		M.cost = defaultCost;
+		n = sscanf(line,"%63s %63s %d %d",M.scalar,M.vector,&M.lanes,&M.cost);
+		if(n <= 0){
+			continue;
+		}
+		if(n < 3 || M.lanes < 0 || M.lanes > MAX_LANES || (M.lanes & (M.lanes-1)) != 0 || M.cost < 0){
+			fprintf(stderr,"SLP: %s:%d: ignoring malformed math line\n",path,lineNo);
+			continue;
+		}
+		if(MathLoadedCount == cap){
+			cap = cap ? 2*cap : 16;
+			MathLoaded = (MathEntry*) realloc(MathLoaded,cap*sizeof(MathEntry));
+		}
+		MathLoaded[MathLoadedCount++] = M;
+	}
+	fclose(fp);
+}
+
 static bool IsIsomorphic(LLVMValueRef I, LLVMValueRef J)
 {
 	int i=0;
@@ -189,8 +690,9 @@ static bool IsIsomorphic(LLVMValueRef I, LLVMValueRef J)
 	if((!LLVMIsAInstruction(I)) || (!LLVMIsAInstruction(J))){
 		return false;	
 	}
-	//their opcodes should be same
-	if(LLVMGetInstructionOpcode(I) != LLVMGetInstructionOpcode(J)){
+	//their opcodes should be same, or alternate like add and sub
+	if(LLVMGetInstructionOpcode(I) != LLVMGetInstructionOpcode(J) &&
+	   AltOpcode(LLVMGetInstructionOpcode(I)) != LLVMGetInstructionOpcode(J)){
 		return false;	
 	}
 	//types should be same
@@ -201,24 +703,327 @@ static bool IsIsomorphic(LLVMValueRef I, LLVMValueRef J)
 	if(LLVMGetNumOperands(I) != LLVMGetNumOperands(J)){
 		return false;	
 	}
+	//calls must go to one math function that has a vector form
+	if(LLVMIsACallInst(I) && (LLVMGetCalledValue(I) != LLVMGetCalledValue(J) || MathLookup(I,0) == NULL)){
+		return false;
+	}
+	//compares must test the same way
+	if(LLVMIsAICmpInst(I) && LLVMGetICmpPredicate(I) != LLVMGetICmpPredicate(J)){
+		return false;
+	}
+	if(LLVMIsAFCmpInst(I) && LLVMGetFCmpPredicate(I) != LLVMGetFCmpPredicate(J)){
+		return false;
+	}
+	//the only operand of an alloca is its (constant) array size
+	if(LLVMIsAAllocaInst(I)){
+		return LLVMGetOperand(I,0) == LLVMGetOperand(J,0);
+	}
+	//PHIs must merge the same edges in the same order
+	if(LLVMIsAPHINode(I)){
+		for(i=0;i<(int)LLVMCountIncoming(I);i++){
+			if(LLVMGetIncomingBlock(I,i) != LLVMGetIncomingBlock(J,i)){
+				return false;
+			}
+		}
+	}
 	//type of all operands must match
 	for(i=0;i<LLVMGetNumOperands(I);i++){
-		if(LLVMIsAInstruction(LLVMGetOperand(I,i)) && LLVMIsAInstruction(LLVMGetOperand(J,i))){
-			if(LLVMTypeOf(LLVMGetOperand(I,i)) != LLVMTypeOf(LLVMGetOperand(J,i))){
-				return false;
-			}		
-		}else{
-			//operand is not an inst???what to do in such case? not isomorphic = too conservative??
-			return false;	
+		//constants and arguments are fine too, they are packed into a vector,
+		//and so is an address that is an argument or a global
+		if(LLVMTypeOf(LLVMGetOperand(I,i)) != LLVMTypeOf(LLVMGetOperand(J,i))){
+			return false;
 		}
 	}
 //	printf("found isomorphic pair\n");
 	return true;
 }
 
+//every lane must be isomorphic to lane 0
+static bool IsIsomorphicPack(LLVMValueRef *lanes, int n)
+{
+	int k;
+	for(k=1;k<n;k++){
+		if(!IsIsomorphic(lanes[0],lanes[k])){
+			return false;
+		}
+	}
+	return true;
+}
+
+//per block dependence information
+//the backward slice of an instruction (all instructions of the same BB it
+//transitively uses) is computed once as a bitset over dense block indices
+//and reused by every CheckDependence query
+#define WORD_BITS (8*sizeof(unsigned long))
+
+static void depDestroy()
+{
+  int i;
+  for(i=0;i<Ctx->Dep.count;i++)
+    free(Ctx->Dep.slices[i].bits);
+  free(Ctx->Dep.slices);
+  free(Ctx->Dep.erased);
+  if(Ctx->Dep.idx)
+    valmap_destroy(Ctx->Dep.idx);
+  memset(&Ctx->Dep,0,sizeof(Ctx->Dep));
+}
+
+static int depIndex(LLVMValueRef I)
+{
+  if(Ctx->Dep.BB!=LLVMGetInstructionParent(I)) {
+    depDestroy();
+    Ctx->Dep.BB = LLVMGetInstructionParent(I);
+    Ctx->Dep.idx = valmap_create();
+  }
+  if(valmap_check(Ctx->Dep.idx,I))
+    return (int)(long)valmap_find(Ctx->Dep.idx,I) - 1;
+  if(Ctx->Dep.count==Ctx->Dep.cap) {
+    Ctx->Dep.cap = Ctx->Dep.cap ? 2*Ctx->Dep.cap : 256;
+    Ctx->Dep.slices = (SliceEntry*) realloc(Ctx->Dep.slices,Ctx->Dep.cap*sizeof(SliceEntry));
+  }
+  Ctx->Dep.slices[Ctx->Dep.count].I = I;
+  Ctx->Dep.slices[Ctx->Dep.count].bits = NULL;
+  Ctx->Dep.slices[Ctx->Dep.count].len = 0;
+  valmap_insert(Ctx->Dep.idx,I,(void*)(long)(Ctx->Dep.count+1));
+  return Ctx->Dep.count++;
+}
+
+static int bitTest(unsigned long *bits, int len, int k)
+{
+  return (k/(int)WORD_BITS < len) && ((bits[k/WORD_BITS]>>(k%WORD_BITS))&1);
+}
+
+//true if op contributes to the in block slice of its user
+static bool InSlice(LLVMValueRef op, LLVMBasicBlockRef BB)
+{
+  return LLVMIsAInstruction(op) && LLVMGetInstructionParent(op)==BB;
+}
+
+//compute (or fetch) the backward slice of I
+//iterative post order walk so deep expression trees can not overflow the stack
+static SliceEntry *depSlice(LLVMValueRef I)
+{
+  LLVMBasicBlockRef BB = LLVMGetInstructionParent(I);
+  LLVMValueRef *stack;
+  int top = 0, cap = 64;
+  int k = depIndex(I);
+  int i;
+  if(Ctx->Dep.slices[k].bits)
+    return &Ctx->Dep.slices[k];
+
+  stack = (LLVMValueRef*) malloc(cap*sizeof(LLVMValueRef));
+  stack[top++] = I;
+  while(top>0) {
+    LLVMValueRef T = stack[top-1];
+    int t = depIndex(T);
+    int ready = 1;
+    if(Ctx->Dep.slices[t].bits) {
+      top--;
+      continue;
+    }
+    //PHIs take their operands from the previous trip, not from this BB
+    if(!LLVMIsAPHINode(T)) {
+      for(i=0;i<LLVMGetNumOperands(T);i++) {
+        LLVMValueRef op = LLVMGetOperand(T,i);
+        int o;
+        if(!InSlice(op,BB))
+          continue;
+        o = depIndex(op);//may grow Ctx->Dep.slices
+        if(Ctx->Dep.slices[o].bits)
+          continue;
+        if(top==cap) {
+          cap *= 2;
+          stack = (LLVMValueRef*) realloc(stack,cap*sizeof(LLVMValueRef));
+        }
+        stack[top++] = op;
+        ready = 0;
+      }
+    }
+    if(!ready)
+      continue;
+    //all operand slices are known, union them
+    {
+      int len = Ctx->Dep.count/WORD_BITS + 1;
+      unsigned long *bits = (unsigned long*) calloc(len,sizeof(unsigned long));
+      if(!LLVMIsAPHINode(T)) {
+        for(i=0;i<LLVMGetNumOperands(T);i++) {
+          LLVMValueRef op = LLVMGetOperand(T,i);
+          SliceEntry *e;
+          int o,w;
+          if(!InSlice(op,BB))
+            continue;
+          o = depIndex(op);
+          e = &Ctx->Dep.slices[o];
+          for(w=0;w<e->len;w++)
+            bits[w] |= e->bits[w];
+          bits[o/WORD_BITS] |= 1UL<<(o%WORD_BITS);
+        }
+      }
+      t = depIndex(T);
+      Ctx->Dep.slices[t].bits = bits;
+      Ctx->Dep.slices[t].len = len;
+      top--;
+    }
+  }
+  free(stack);
+  return &Ctx->Dep.slices[k];
+}
+
+//I is about to be erased, remember its index so dependent slices get dropped
+static void depErase(LLVMValueRef I)
+{
+  int k,len;
+  if(Ctx->Dep.idx==NULL || Ctx->Dep.BB!=LLVMGetInstructionParent(I) || !valmap_check(Ctx->Dep.idx,I))
+    return;
+  k = (int)(long)valmap_find(Ctx->Dep.idx,I) - 1;
+  len = k/WORD_BITS + 1;
+  if(len>Ctx->Dep.erasedLen) {
+    Ctx->Dep.erased = (unsigned long*) realloc(Ctx->Dep.erased,len*sizeof(unsigned long));
+    memset(Ctx->Dep.erased+Ctx->Dep.erasedLen,0,(len-Ctx->Dep.erasedLen)*sizeof(unsigned long));
+    Ctx->Dep.erasedLen = len;
+  }
+  Ctx->Dep.erased[k/WORD_BITS] |= 1UL<<(k%WORD_BITS);
+  free(Ctx->Dep.slices[k].bits);
+  Ctx->Dep.slices[k].bits = NULL;
+  Ctx->Dep.slices[k].I = NULL;
+  valmap_remove(Ctx->Dep.idx,I);
+}
+
+//drop every slice that went through an erased instruction
+//after RAUW those users depend on the new vector code instead
+//they are recomputed on their next query, everything else is kept
+static void depInvalidate()
+{
+  int i,w,n;
+  if(Ctx->Dep.erased==NULL)
+    return;
+  for(i=0;i<Ctx->Dep.count;i++) {
+    SliceEntry *e = &Ctx->Dep.slices[i];
+    if(e->bits==NULL)
+      continue;
+    n = e->len<Ctx->Dep.erasedLen ? e->len : Ctx->Dep.erasedLen;
+    for(w=0;w<n;w++) {
+      if(e->bits[w] & Ctx->Dep.erased[w]) {
+        free(e->bits);
+        e->bits = NULL;
+        break;
+      }
+    }
+  }
+  free(Ctx->Dep.erased);
+  Ctx->Dep.erased = NULL;
+  Ctx->Dep.erasedLen = 0;
+}
+
+//candidate seeding
+//instructions are bucketed by an isomorphism signature (opcode, result
+//type, operand count, operand types) in one pass over the block so that
+//seeding only compares instructions that can possibly be isomorphic
+#define SEED_WINDOW 64
+
+typedef struct {
+  LLVMValueRef *insts;//bucket members in block order
+  int size;
+  int cap;
+} SeedBucket;
+
+typedef struct {
+  SeedBucket *buckets;
+  int count;
+  int cap;
+  int *order;//visit order, store rooted buckets first
+  int *table;//open addressing hash -> bucket index, -1 if empty
+  int tsize;
+} SeedTable;
+
+static unsigned long signatureHash(LLVMValueRef I)
+{
+  int i;
+  LLVMOpcode op = LLVMGetInstructionOpcode(I);
+  //alternating opcodes go in one bucket
+  if(op == LLVMSub || op == LLVMFSub)
+    op = AltOpcode(op);
+  unsigned long h = (unsigned long)op;
+  h = h*31 + (unsigned long)LLVMTypeOf(I);
+  h = h*31 + (unsigned long)LLVMGetNumOperands(I);
+  if(LLVMIsAICmpInst(I))
+    h = h*31 + (unsigned long)LLVMGetICmpPredicate(I);
+  if(LLVMIsAFCmpInst(I))
+    h = h*31 + (unsigned long)LLVMGetFCmpPredicate(I);
+  if(LLVMIsACallInst(I))
+    h = h*31 + (unsigned long)LLVMGetCalledValue(I);
+  for(i=0;i<LLVMGetNumOperands(I);i++)
+    h = h*31 + (unsigned long)LLVMTypeOf(LLVMGetOperand(I,i));
+  return h ^ (h>>17);
+}
+
+static void seedDestroy(SeedTable *S)
+{
+  int i;
+  for(i=0;i<S->count;i++)
+    free(S->buckets[i].insts);
+  free(S->buckets);
+  free(S->order);
+  free(S->table);
+  memset(S,0,sizeof(SeedTable));
+}
+
+static void seedCollect(SeedTable *S, LLVMBasicBlockRef BB)
+{
+  LLVMValueRef I;
+  int n = 0, i, k;
+  seedDestroy(S);
+  for(I=LLVMGetFirstInstruction(BB);I!=NULL;I=LLVMGetNextInstruction(I))
+    n++;
+  S->tsize = 16;
+  while(S->tsize < 2*n)
+    S->tsize *= 2;
+  S->table = (int*) malloc(S->tsize*sizeof(int));
+  for(i=0;i<S->tsize;i++)
+    S->table[i] = -1;
+
+  for(I=LLVMGetFirstInstruction(BB);I!=NULL;I=LLVMGetNextInstruction(I)) {
+    SeedBucket *bucket;
+    //an instruction that is not isomorphic to itself never pairs
+    if(!IsIsomorphic(I,I))
+      continue;
+    k = signatureHash(I) & (S->tsize-1);
+    while(S->table[k]!=-1 && !IsIsomorphic(S->buckets[S->table[k]].insts[0],I))
+      k = (k+1) & (S->tsize-1);
+    if(S->table[k]==-1) {
+      if(S->count==S->cap) {
+        S->cap = S->cap ? 2*S->cap : 16;
+        S->buckets = (SeedBucket*) realloc(S->buckets,S->cap*sizeof(SeedBucket));
+      }
+      S->buckets[S->count].insts = NULL;
+      S->buckets[S->count].size = 0;
+      S->buckets[S->count].cap = 0;
+      S->table[k] = S->count++;
+    }
+    bucket = &S->buckets[S->table[k]];
+    if(bucket->size==bucket->cap) {
+      bucket->cap = bucket->cap ? 2*bucket->cap : 4;
+      bucket->insts = (LLVMValueRef*) realloc(bucket->insts,bucket->cap*sizeof(LLVMValueRef));
+    }
+    bucket->insts[bucket->size++] = I;
+  }
+
+  //stores are the profitable roots, try them first
+  S->order = (int*) malloc((S->count+1)*sizeof(int));
+  n = 0;
+  for(i=0;i<S->count;i++)
+    if(LLVMIsAStoreInst(S->buckets[i].insts[0]))
+      S->order[n++] = i;
+  for(i=0;i<S->count;i++)
+    if(!LLVMIsAStoreInst(S->buckets[i].insts[0]))
+      S->order[n++] = i;
+}
+
+//I is dependent on J: J is in the full backward slice of I within BB
 static bool CheckDependence(LLVMValueRef I, LLVMValueRef J)
 {
-	int i = 0;
+	SliceEntry *e;
+	int j;
 	//both should be instructions
 	if((!LLVMIsAInstruction(I)) || (!LLVMIsAInstruction(J))){
 		return false;	
@@ -231,19 +1036,168 @@ static bool CheckDependence(LLVMValueRef I, LLVMValueRef J)
 	if(I == J){
 		return true;	
 	}
-	//check dependency along the chain of operands
-	for(i = 0;i<LLVMGetNumOperands(I);i++){
-		if(LLVMIsAInstruction(LLVMGetOperand(I,i))){
-			if(CheckDependence(LLVMGetOperand(I,i),J) == true){
-				return true;	
-			}	
+	j = depIndex(J);
+	e = depSlice(I);
+	return bitTest(e->bits,e->len,j);
+}
+
+//erase I and drop it from the per block side tables
+static void eraseInst(LLVMValueRef I)
+{
+	orderErase(I);
+	depErase(I);
+	if(Ctx->Reg.live){
+		valmap_remove(Ctx->Reg.live,I);
+		valmap_remove(Ctx->Reg.vec,I);
+	}
+	LLVMInstructionEraseFromParent(I);
+}
+
+//the value lane k of V was built from: follows insertelement chains and
+//shufflevectors, NULL when it can not be told
+static LLVMValueRef GatheredLane(LLVMValueRef V, int k)
+{
+	LLVMValueRef idx;
+	int m, w;
+	while(V && k >= 0){
+		if(LLVMIsAInsertElementInst(V)){
+			idx = LLVMGetOperand(V,2);
+			if(!LLVMIsAConstantInt(idx)){
+				return NULL;
+			}
+			if(LLVMConstIntGetZExtValue(idx) == (unsigned long long)k){
+				return LLVMGetOperand(V,1);
+			}
+			V = LLVMGetOperand(V,0);
+		}else if(LLVMIsAShuffleVectorInst(V)){
+			m = LLVMGetMaskValue(V,k);
+			w = LLVMGetVectorSize(LLVMTypeOf(LLVMGetOperand(V,0)));
+			V = LLVMGetOperand(V,m < w ? 0 : 1);
+			k = m < w ? m : m-w;
 		}else{
-		//what to do if an operand is not an instruction should we mark it independent or dependent or just ignore
-		//	return false;	
+			return NULL;
 		}
 	}
-	return false;
-	
+	return NULL;
+}
+
+//a vector that already holds s and the lane it is in: an extractelement
+//names both, a scalar gathered earlier in the block is found in the registry
+static LLVMValueRef VectorLaneOf(LLVMValueRef s, int *lane)
+{
+	LLVMValueRef V, idx;
+	if(LLVMIsAExtractElementInst(s)){
+		idx = LLVMGetOperand(s,1);
+		if(!LLVMIsAConstantInt(idx)){
+			return NULL;
+		}
+		*lane = (int)LLVMConstIntGetZExtValue(idx);
+		return LLVMGetOperand(s,0);
+	}
+	if(Ctx->Reg.vec == NULL || !valmap_check(Ctx->Reg.vec,s)){
+		return NULL;
+	}
+	V = (LLVMValueRef)valmap_find(Ctx->Reg.vec,s);
+	//the vector may be gone, and a new one may live at its address
+	if(!valmap_check(Ctx->Reg.live,V)){
+		return NULL;
+	}
+	*lane = (int)(long)valmap_find(Ctx->Reg.lane,s)-1;
+	if(GatheredLane(V,*lane) != s){
+		return NULL;
+	}
+	return V;
+}
+
+//remember the lanes of a vector gathered from scalars
+static void regRecord(LLVMValueRef V, LLVMValueRef *lanes, int n)
+{
+	int k, l;
+	if(!LLVMIsAInstruction(V)){
+		return;
+	}
+	if(Ctx->Reg.vec == NULL){
+		Ctx->Reg.vec = valmap_create();
+		Ctx->Reg.lane = valmap_create();
+		Ctx->Reg.live = valmap_create();
+	}
+	valmap_insert(Ctx->Reg.live,V,(void*)1);
+	for(k=0;k<n;k++){
+		if(LLVMIsAConstant(lanes[k]) || VectorLaneOf(lanes[k],&l) != NULL){
+			continue;
+		}
+		valmap_insert(Ctx->Reg.vec,lanes[k],(void*)V);
+		valmap_insert(Ctx->Reg.lane,lanes[k],(void*)(long)(k+1));
+	}
+}
+
+static void regDestroy()
+{
+	if(Ctx->Reg.vec){
+		valmap_destroy(Ctx->Reg.vec);
+		valmap_destroy(Ctx->Reg.lane);
+		valmap_destroy(Ctx->Reg.live);
+	}
+	Ctx->Reg.vec = Ctx->Reg.lane = Ctx->Reg.live = NULL;
+}
+
+//where the n lanes of an operand can be read from without gathering them:
+//at most two sources of the same width, fills in the shufflevector mask
+//over them and returns the number of sources, 0 if there are none.
+//while scoring (List set) the packs of the list are sources, while
+//vectorizing (op2vec set) the vectors built for them are
+static int FindLaneSources(VectorList *List, valmap_t op2vec, valmap_t op2lane,
+		LLVMValueRef *lanes, int n, void **srcs, int *width, int *mask)
+{
+	VectorPair *P;
+	LLVMValueRef V;
+	void *src;
+	int k, j, l, w, nsrc = 0;
+	for(k=0;k<n;k++){
+		src = NULL;
+		if(List && valmap_check(List->visited,lanes[k])){
+			P = (VectorPair*)valmap_find(List->visited,lanes[k]);
+			for(l=0;P->pair[l] != lanes[k];l++);
+			src = P;
+			w = P->lanes;
+		}else if(op2vec && valmap_check(op2vec,lanes[k])){
+			src = valmap_find(op2vec,lanes[k]);
+			l = (int)(long)valmap_find(op2lane,lanes[k])-1;
+			w = LLVMGetVectorSize(LLVMTypeOf((LLVMValueRef)src));
+		}else if((V = VectorLaneOf(lanes[k],&l)) != NULL){
+			w = LLVMGetVectorSize(LLVMTypeOf(V));
+			//prefer the lane that needs no moving
+			if(k < w && GatheredLane(V,k) == lanes[k]){
+				l = k;
+			}
+			src = V;
+		}
+		if(src == NULL){
+			return 0;
+		}
+		for(j=0;j<nsrc && srcs[j] != src;j++);
+		if(j == nsrc){
+			if(nsrc == 2 || (nsrc == 1 && (w != *width ||
+					(!List && LLVMTypeOf((LLVMValueRef)src) != LLVMTypeOf((LLVMValueRef)srcs[0]))))){
+				return 0;
+			}
+			srcs[nsrc++] = src;
+			*width = w;
+		}
+		mask[k] = j*w + l;
+	}
+	return nsrc;
+}
+
+//the sources hold the lanes in place already
+static bool IsIdentityReuse(int nsrc, int width, int *mask, int n)
+{
+	int k;
+	if(nsrc != 1 || width != n){
+		return false;
+	}
+	for(k=0;k<n && mask[k]==k;k++);
+	return k == n;
 }
 
 static bool IsFloat(LLVMValueRef I)
@@ -296,15 +1250,261 @@ static bool IsIntFloatPtr(LLVMValueRef I){
 	
 }
 
-static bool ShouldVectorize(LLVMValueRef I, LLVMValueRef J)
+//size query on the data layout, only aggregates can reach its layout cache
+static unsigned long long LayoutQuery(unsigned long long (*query)(LLVMTargetDataRef,LLVMTypeRef), LLVMTypeRef T)
 {
-	//if typeof I not integer float or ptr
-	if(IsIntFloatPtr(I) == false){
-		return false;	
+	unsigned long long r;
+	if(LLVMGetTypeKind(T) != LLVMStructTypeKind && LLVMGetTypeKind(T) != LLVMArrayTypeKind){
+		return query(TD,T);
 	}
-	//if I and J are not in same BB
-	if(LLVMGetInstructionParent(I) != LLVMGetInstructionParent(J)){
-		return false;	
+	pthread_mutex_lock(&LayoutLock);
+	r = query(TD,T);
+	pthread_mutex_unlock(&LayoutLock);
+	return r;
+}
+
+//memory access analysis
+//an address is split into base + index*scale + offset, where base is the
+//underlying object (or the first address that can not be looked through),
+//index an optional variable GEP index and offset a constant byte offset
+typedef struct {
+  LLVMValueRef base;
+  LLVMValueRef index;//NULL if the address has no variable part
+  long scale;//bytes per unit of index
+  long offset;
+} MemAddr;
+
+//idx = var + c. Under a sign or zero extension, and in an index narrower
+//than a pointer (the GEP sign extends it), var + c only equals the wide
+//index when the add or sub can not wrap, so nowrap holds the wrap flags
+//an add or sub must carry to be split: nsw below a sext, nuw below a zext
+static void SplitIndex(LLVMValueRef idx, unsigned nowrap, LLVMValueRef *var, long *c)
+{
+	long rhs;
+	while(LLVMIsASExtInst(idx) || LLVMIsAZExtInst(idx)){
+		nowrap |= LLVMIsASExtInst(idx) ? LLVMNoSignedWrap : LLVMNoUnsignedWrap;
+		idx = LLVMGetOperand(idx,0);
+	}
+	if(LLVMIsAConstantInt(idx)){
+		*var = NULL;
+		*c = (nowrap & LLVMNoUnsignedWrap) ? (long)LLVMConstIntGetZExtValue(idx) : LLVMConstIntGetSExtValue(idx);
+		return;
+	}
+	if(LLVMIsAInstruction(idx) && (LLVMGetNoWrapFlags(idx) & nowrap) == nowrap){
+		if((LLVMGetInstructionOpcode(idx) == LLVMAdd || LLVMGetInstructionOpcode(idx) == LLVMSub)
+		   && LLVMIsAConstantInt(LLVMGetOperand(idx,1))){
+			SplitIndex(LLVMGetOperand(idx,1),nowrap,var,&rhs);
+			SplitIndex(LLVMGetOperand(idx,0),nowrap,var,c);
+			*c += LLVMGetInstructionOpcode(idx) == LLVMAdd ? rhs : -rhs;
+			return;
+		}
+		if(LLVMGetInstructionOpcode(idx) == LLVMAdd && LLVMIsAConstantInt(LLVMGetOperand(idx,0))){
+			SplitIndex(LLVMGetOperand(idx,0),nowrap,var,&rhs);
+			SplitIndex(LLVMGetOperand(idx,1),nowrap,var,c);
+			*c += rhs;
+			return;
+		}
+	}
+	*var = idx;
+	*c = 0;
+}
+
+static void DecomposeAddress(LLVMValueRef P, MemAddr *A)
+{
+	LLVMTypeRef T;
+	LLVMValueRef var;
+	long c, size;
+	int i;
+	MemAddr inner;
+
+	//constant expressions too, that is how addresses of globals usually look
+	if(LLVMIsABitCastInst(P) || (LLVMIsAConstantExpr(P) && LLVMGetConstOpcode(P) == LLVMBitCast)){
+		DecomposeAddress(LLVMGetOperand(P,0),A);
+		return;
+	}
+	if(!LLVMIsAGetElementPtrInst(P) && !(LLVMIsAConstantExpr(P) && LLVMGetConstOpcode(P) == LLVMGetElementPtr)){
+		A->base = P;
+		A->index = NULL;
+		A->scale = 0;
+		A->offset = 0;
+		return;
+	}
+	DecomposeAddress(LLVMGetOperand(P,0),&inner);
+	T = LLVMGetGEPSourceElementType(P);
+	for(i=1;i<LLVMGetNumOperands(P);i++){
+		LLVMValueRef idx = LLVMGetOperand(P,i);
+		if(i>1 && LLVMGetTypeKind(T) == LLVMStructTypeKind){
+			//struct fields always have constant indices
+			c = LLVMConstIntGetZExtValue(idx);
+			pthread_mutex_lock(&LayoutLock);
+			inner.offset += LLVMOffsetOfElement(TD,T,c);
+			pthread_mutex_unlock(&LayoutLock);
+			T = LLVMStructGetTypeAtIndex(T,c);
+			continue;
+		}
+		if(i>1){
+			T = LLVMGetElementType(T);
+		}
+		size = LayoutQuery(LLVMABISizeOfType,T);
+		SplitIndex(idx,LLVMGetIntTypeWidth(LLVMTypeOf(idx)) < 8*LLVMPointerSize(TD) ? LLVMNoSignedWrap : 0,&var,&c);
+		inner.offset += c*size;
+		if(var){
+			if(inner.index && (inner.index != var || inner.scale != size)){
+				//more than one variable part, give up looking through P
+				A->base = P;
+				A->index = NULL;
+				A->scale = 0;
+				A->offset = 0;
+				return;
+			}
+			inner.index = var;
+			inner.scale = size;
+		}
+	}
+	*A = inner;
+}
+
+//the object behind base can only be reached through base
+static bool IsIdentifiedObject(LLVMValueRef base)
+{
+	return LLVMIsAAllocaInst(base) || LLVMIsAGlobalVariable(base);
+}
+
+//can the accesses of memory instructions X and Y overlap?
+static bool MayAlias(LLVMValueRef X, LLVMValueRef Y)
+{
+	MemAddr a,b;
+	long sa,sb;
+	if(PointerOperand(X) < 0 || PointerOperand(Y) < 0){
+		return true;
+	}
+	DecomposeAddress(LLVMGetOperand(X,PointerOperand(X)),&a);
+	DecomposeAddress(LLVMGetOperand(Y,PointerOperand(Y)),&b);
+	if(a.base != b.base){
+		//distinct allocas and globals never overlap, an argument can
+		//not point to an alloca of this function either
+		if(IsIdentifiedObject(a.base) && IsIdentifiedObject(b.base)){
+			return false;
+		}
+		if((LLVMIsAAllocaInst(a.base) && LLVMIsAArgument(b.base)) ||
+		   (LLVMIsAAllocaInst(b.base) && LLVMIsAArgument(a.base))){
+			return false;
+		}
+		return true;
+	}
+	if(a.index != b.index || a.scale != b.scale){
+		return true;
+	}
+	sa = LayoutQuery(LLVMStoreSizeOfType,LLVMTypeOf(LLVMIsAStoreInst(X) ? LLVMGetOperand(X,0) : X));
+	sb = LayoutQuery(LLVMStoreSizeOfType,LLVMTypeOf(LLVMIsAStoreInst(Y) ? LLVMGetOperand(Y,0) : Y));
+	return a.offset < b.offset+sb && b.offset < a.offset+sa;
+}
+
+//how a pack of loads or stores can become a single vector access
+#define MEM_NONE 0
+#define MEM_ALLOCA 1//every lane has its own alloca, the allocas are packed too
+#define MEM_CONSECUTIVE 2//lane k accesses the element right after lane k-1
+#define MEM_STRIDED 3//lane k accesses the element a fixed stride after lane k-1
+#define MAX_STRIDE 4//elements between two lanes of a strided pack, xyzw records
+
+static int MemoryPackKind(LLVMValueRef *lanes, int n)
+{
+	MemAddr first,cur;
+	LLVMTypeRef T;
+	long size, stride;
+	int k,p = PointerOperand(lanes[0]);
+	bool allAlloca = true;
+
+	for(k=0;k<n;k++){
+		if(!LLVMIsAAllocaInst(LLVMGetOperand(lanes[k],p)) || !IsIntFloatDoubleAlloca(LLVMGetOperand(lanes[k],p))){
+			allAlloca = false;
+		}
+	}
+	//each lane needs an alloca of its own
+	for(k=0;k<n && allAlloca;k++){
+		int j;
+		for(j=0;j<k;j++){
+			if(LLVMGetOperand(lanes[j],p) == LLVMGetOperand(lanes[k],p)){
+				allAlloca = false;
+			}
+		}
+	}
+	if(allAlloca){
+		return MEM_ALLOCA;
+	}
+	T = LLVMTypeOf(LLVMIsAStoreInst(lanes[0]) ? LLVMGetOperand(lanes[0],0) : lanes[0]);
+	size = LayoutQuery(LLVMABISizeOfType,T);
+	//no padding between the elements of the vector
+	if(size != (long)LayoutQuery(LLVMStoreSizeOfType,T)){
+		return MEM_NONE;
+	}
+	DecomposeAddress(LLVMGetOperand(lanes[0],p),&first);
+	DecomposeAddress(LLVMGetOperand(lanes[1],p),&cur);
+	//the same field of consecutive records, like the x of an array of points
+	stride = cur.offset - first.offset;
+	if(stride <= 0 || stride % size != 0 || stride > MAX_STRIDE*size){
+		return MEM_NONE;
+	}
+	for(k=1;k<n;k++){
+		DecomposeAddress(LLVMGetOperand(lanes[k],p),&cur);
+		if(cur.base != first.base || cur.index != first.index || cur.scale != first.scale ||
+		   cur.offset != first.offset+k*stride){
+			return MEM_NONE;
+		}
+	}
+	return stride == size ? MEM_CONSECUTIVE : MEM_STRIDED;
+}
+
+//elements from the address of one lane of a load or store pack to the next
+static long PackStride(VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0];
+	int p = PointerOperand(I);
+	MemAddr a,b;
+	DecomposeAddress(LLVMGetOperand(ptr->pair[0],p),&a);
+	DecomposeAddress(LLVMGetOperand(ptr->pair[1],p),&b);
+	return (b.offset - a.offset)/(long)LayoutQuery(LLVMABISizeOfType,LLVMTypeOf(LLVMIsAStoreInst(I) ? LLVMGetOperand(I,0) : I));
+}
+
+//the preheader of BB when BB is a whole loop by itself, NULL otherwise
+static LLVMBasicBlockRef LoopPreheader(LLVMBasicBlockRef BB)
+{
+	LLVMValueRef V = LLVMBasicBlockAsValue(BB);
+	if(Ctx->Loops == NULL || !valmap_check(Ctx->Loops,V)){
+		return NULL;
+	}
+	return (LLVMBasicBlockRef)valmap_find(Ctx->Loops,V);
+}
+
+//I is a PHI of a single block loop that takes an integer or float from the
+//preheader and the next value from the end of the trip
+static bool IsLoopPHI(LLVMValueRef I)
+{
+	LLVMBasicBlockRef H = LLVMGetInstructionParent(I), P = LoopPreheader(H);
+	LLVMTypeKind kind = LLVMGetTypeKind(LLVMTypeOf(I));
+	int i, n = 0;
+	if(P == NULL || LLVMCountIncoming(I) != 2 || (kind != LLVMIntegerTypeKind && !IsFloat(I))){
+		return false;
+	}
+	for(i=0;i<2;i++){
+		n += LLVMGetIncomingBlock(I,i) == P ? 1 : LLVMGetIncomingBlock(I,i) == H ? 2 : 0;
+	}
+	return n == 3;
+}
+
+static bool ShouldVectorize(LLVMValueRef I, LLVMValueRef J)
+{
+	//if typeof I (or the value a store writes) not integer float or ptr
+	if(IsIntFloatPtr(LLVMIsAStoreInst(I) ? LLVMGetOperand(I,0) : I) == false){
+		return false;	
+	}
+	//an alloca pack becomes an alloca of a vector
+	if(LLVMIsAAllocaInst(I) && !IsIntFloatDoubleAlloca(I)){
+		return false;
+	}
+	//if I and J are not in same BB
+	if(LLVMGetInstructionParent(I) != LLVMGetInstructionParent(J)){
+		return false;	
 	}
 	//if I is a terminator
 	if(LLVMIsATerminatorInst(I)){
@@ -340,26 +1540,21 @@ static bool ShouldVectorize(LLVMValueRef I, LLVMValueRef J)
 //	case LLVMAlloca: 	
 //	case LLVMLoad: 	
 //	case LLVMStore: 	
-	case LLVMGetElementPtr:
-	case LLVMTrunc:
-	case LLVMZExt: 	
-	case LLVMSExt: 	
-	case LLVMFPToUI: 	
-	case LLVMFPToSI: 	
-	case LLVMUIToFP: 	
-	case LLVMSIToFP: 	
-	case LLVMFPTrunc: 	
-	case LLVMFPExt:
-	case LLVMPtrToInt: 	
-	case LLVMIntToPtr:	
+//	case LLVMTrunc:
+//	case LLVMZExt: 	
+//	case LLVMSExt: 	
+//	case LLVMFPToUI: 	
+//	case LLVMFPToSI: 	
+//	case LLVMUIToFP: 	
+//	case LLVMSIToFP: 	
+//	case LLVMFPTrunc: 	
+//	case LLVMFPExt:
+//	case LLVMPtrToInt: 	
+//	case LLVMIntToPtr:	
+//	case LLVMBitCast:
 //try to vectorize all before this
-	case LLVMBitCast:
+	case LLVMGetElementPtr:
 	case LLVMAddrSpaceCast: 	
-	case LLVMICmp:
-	case LLVMFCmp:	
-	case LLVMPHI:
-	case LLVMCall: 	
-	case LLVMSelect: 	
 	case LLVMUserOp1: 	
 	case LLVMUserOp2:	
 	case LLVMVAArg:
@@ -378,36 +1573,22 @@ static bool ShouldVectorize(LLVMValueRef I, LLVMValueRef J)
 		break;
 	}
 	
-	if(LLVMIsALoadInst(I)){
-		//if I is a volatile load
-		if(LLVMGetVolatile(I)){
-			return false;
-		}
-		//if I is a load that comes from an alloca that holds the address of an integer, float, or double
-		if(LLVMIsAAllocaInst(LLVMGetOperand(I,0))){
-			if(IsIntFloatDoubleAlloca(LLVMGetOperand(I,0))){
-				return true;
-			}else
-				return false;	
-		}else{
-			return false;	
-		}
+	//a call only when it is a pure math function with a vector form
+	if(LLVMIsACallInst(I) && MathLookup(I,0) == NULL){
+		return false;
 	}
-
-	if(LLVMIsAStoreInst(I)){
-		//if I is a volatile store
-		if(LLVMGetVolatile(I)){
+	//a PHI only when it carries a value around a loop, see IsLoopPHI
+	if(LLVMIsAPHINode(I) && !IsLoopPHI(I)){
+		return false;
+	}
+	if(LLVMIsALoadInst(I) || LLVMIsAStoreInst(I)){
+		//if I is a volatile or atomic access
+		if(LLVMGetVolatile(I) || LLVMGetOrdering(I) != LLVMAtomicOrderingNotAtomic){
 			return false;
 		}
-		//if I is a load that comes from an alloca that holds the address of an integer, float, or double
-		if(LLVMIsAAllocaInst(LLVMGetOperand(I,1))){
-			if(IsIntFloatDoubleAlloca(LLVMGetOperand(I,1))){
-				return true;
-			}else
-				return false;	
-		}else{
-			return false;	
-		}
+		//the accessed type (an integer, float, or double) was checked above,
+		//whether the addresses can form one vector access is a property of
+		//the whole pack, see MemoryPackKind
 	}
 
 	//check dependency inside BB
@@ -418,48 +1599,195 @@ static bool ShouldVectorize(LLVMValueRef I, LLVMValueRef J)
 	return true;
 }
 
-static VectorList* CollectIsomorphicInsts(VectorList* oldList, LLVMValueRef I, LLVMValueRef J)
+//no lane of the pack may depend on another one
+static bool ShouldVectorizePack(LLVMValueRef *lanes, int n)
 {
-	VectorList* List = NULL;
-	int i = 0;
-	
-	//check params
-	if( I == NULL || J == NULL){
-		return NULL;
+	int s,t;
+	if(PointerOperand(lanes[0]) >= 0 && MemoryPackKind(lanes,n) == MEM_NONE){
+		return false;
 	}
-	//if shouldvectorize I,J
-	if(!ShouldVectorize(I,J))
-	{
-		return NULL;
+	if(LLVMIsACallInst(lanes[0]) && MathLookup(lanes[0],n) == NULL){
+		return false;
 	}
-	List = oldList;
-	if(List == NULL){
-		List = create();	
+	for(s=0;s<n;s++){
+		for(t=0;t<n;t++){
+			if(s!=t && !ShouldVectorize(lanes[s],lanes[t])){
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+//number of lanes of I's element type that fit in a vector register
+static int MaxLanes(LLVMValueRef I)
+{
+	//a compare is as wide as the values it compares, not as its i1
+	LLVMTypeRef T = LLVMIsAStoreInst(I) || LLVMIsACmpInst(I) ? LLVMTypeOf(LLVMGetOperand(I,0)) : LLVMTypeOf(I);
+	int bits, n = 2;
+	if(LLVMIsAAllocaInst(I)){
+		T = LLVMGetElementType(T);
+	}
+	switch(LLVMGetTypeKind(T)){
+		case LLVMHalfTypeKind:
+			bits = 16;
+			break;
+		case LLVMFloatTypeKind:
+			bits = 32;
+			break;
+		case LLVMDoubleTypeKind:
+		case LLVMPointerTypeKind:
+			bits = 64;
+			break;
+		case LLVMIntegerTypeKind:
+			bits = LLVMGetIntTypeWidth(T);
+			break;
+		default:
+			bits = 128;
+			break;
 	}
-	//if I or J already in list return list
-	if(valmap_check(List->visited,I) || valmap_check(List->visited,J)){
-		return List;	
+	while(2*n*bits <= VectorBits && 2*n <= MAX_LANES){
+		n *= 2;
 	}
-	//insert I or J in dom order
-	if(dominBB(I,J))
-		addPair(List,I,J);
-	else
-		addPair(List,J,I);
+	return n;
+}
 
-	for(i=0;i<LLVMGetNumOperands(I);i++){
-		if(LLVMIsConstant(LLVMGetOperand(I,i)) && LLVMIsConstant(LLVMGetOperand(I,i))){
-			//how to handle constants???
-			//not adding constants too conservative?
-//			continue;	
+static bool IsCommutative(LLVMValueRef I)
+{
+	switch(LLVMGetInstructionOpcode(I)){
+		case LLVMAdd:
+		case LLVMMul:
+		case LLVMAnd:
+		case LLVMOr:
+		case LLVMXor:
+		case LLVMFAdd:
+		case LLVMFMul:
+			return true;
+		default:
+			return false;
+	}
+}
+
+//operand i of lane k as the pack sees it
+static LLVMValueRef PackOperand(VectorPair *ptr, int k, int i)
+{
+	if(i < 2 && (ptr->swapped>>k & 1)){
+		i = 1-i;
+	}
+	return LLVMGetOperand(ptr->pair[k],i);
+}
+
+static int LookAheadPair(LLVMValueRef a, LLVMValueRef b, int depth);
+
+//how well b would do in the lane next to a, looking depth levels down:
+//the same value (a splat), two constants, or isomorphic instructions
+//whose own operands match up
+static int LookAhead(LLVMValueRef a, LLVMValueRef b, int depth)
+{
+	LookAheadEntry *e;
+	if(a == b){
+		return 4;
+	}
+	if(LLVMIsAConstant(a) && LLVMIsAConstant(b)){
+		return 3;
+	}
+	if(LLVMIsAArgument(a) && LLVMIsAArgument(b)){
+		return 1;
+	}
+	if(!LLVMIsAInstruction(a) || !LLVMIsAInstruction(b) || LLVMGetInstructionParent(a) != LLVMGetInstructionParent(b)){
+		return 0;
+	}
+	//the same pairs come up again under every pack of a chain
+	e = &Ctx->look[(((unsigned long)a>>4)*31 + ((unsigned long)b>>4)*7 + depth) % LOOKAHEAD_CACHE];
+	if(e->build == Ctx->build && e->a == a && e->b == b && e->depth == depth){
+		return e->score;
+	}
+	e->a = a;
+	e->b = b;
+	e->depth = depth;
+	e->score = LookAheadPair(a,b,depth);
+	e->build = Ctx->build;
+	return e->score;
+}
+
+//the look-ahead score of isomorphic instructions a and b of one block
+static int LookAheadPair(LLVMValueRef a, LLVMValueRef b, int depth)
+{
+	int i, straight = 0, swapped = 0;
+	MemAddr A, B;
+	if(!IsIsomorphic(a,b)){
+		return 0;
+	}
+	if(LLVMIsALoadInst(a)){
+		//loads off the same base are likely to become one access
+		DecomposeAddress(LLVMGetOperand(a,0),&A);
+		DecomposeAddress(LLVMGetOperand(b,0),&B);
+		return A.base == B.base && A.index == B.index ? 3 : 2;
+	}
+	if(depth == 0 || LLVMGetNumOperands(a) < 2){
+		return 2;
+	}
+	for(i=0;i<2;i++){
+		straight += LookAhead(LLVMGetOperand(a,i),LLVMGetOperand(b,i),depth-1);
+	}
+	if(IsCommutative(a)){
+		for(i=0;i<2;i++){
+			swapped += LookAhead(LLVMGetOperand(a,i),LLVMGetOperand(b,1-i),depth-1);
 		}
-		//if operands are instructions check if they can be added to the list
-		if(LLVMIsAInstruction(LLVMGetOperand(I,i)) && LLVMIsAInstruction(LLVMGetOperand(J,i))){
-			if(IsIsomorphic(LLVMGetOperand(I,i),LLVMGetOperand(J,i))){
-				CollectIsomorphicInsts(List,LLVMGetOperand(I,i),LLVMGetOperand(J,i));	
-			}
+	}
+	return 2 + (straight > swapped ? straight : swapped);
+}
+
+//read the operands of commutative lanes in whichever order matches lane 0 best
+#define LOOKAHEAD_DEPTH 2
+
+//whether a and b can share a pack as they are: the same value, two
+//constants, loads off the same base or other isomorphic instructions
+//of one block
+static bool OperandsPair(LLVMValueRef a, LLVMValueRef b)
+{
+	MemAddr A, B;
+	if(a == b || (LLVMIsAConstant(a) && LLVMIsAConstant(b))){
+		return true;
+	}
+	if(!LLVMIsAInstruction(a) || !LLVMIsAInstruction(b) ||
+	   LLVMGetInstructionParent(a) != LLVMGetInstructionParent(b) || !IsIsomorphic(a,b)){
+		return false;
+	}
+	if(LLVMIsALoadInst(a)){
+		DecomposeAddress(LLVMGetOperand(a,0),&A);
+		DecomposeAddress(LLVMGetOperand(b,0),&B);
+		return A.base == B.base && A.index == B.index;
+	}
+	return true;
+}
+
+static void ReorderOperands(VectorPair *ptr)
+{
+	int k, straight, swapped;
+	LLVMValueRef L0 = ptr->pair[0], L;
+	if(!IsCommutative(L0) && !AltOpcode(LLVMGetInstructionOpcode(L0))){
+		return;
+	}
+	for(k=1;k<ptr->lanes;k++){
+		L = ptr->pair[k];
+		//lanes of the other opcode of an alternating pack may not commute
+		if(!IsCommutative(L)){
+			continue;
+		}
+		//the order the lane has is fine, no need to look further
+		if(OperandsPair(LLVMGetOperand(L0,0),LLVMGetOperand(L,0)) &&
+		   OperandsPair(LLVMGetOperand(L0,1),LLVMGetOperand(L,1))){
+			continue;
+		}
+		straight = LookAhead(LLVMGetOperand(L0,0),LLVMGetOperand(L,0),LOOKAHEAD_DEPTH)
+		         + LookAhead(LLVMGetOperand(L0,1),LLVMGetOperand(L,1),LOOKAHEAD_DEPTH);
+		swapped = LookAhead(LLVMGetOperand(L0,0),LLVMGetOperand(L,1),LOOKAHEAD_DEPTH)
+		        + LookAhead(LLVMGetOperand(L0,1),LLVMGetOperand(L,0),LOOKAHEAD_DEPTH);
+		if(swapped > straight){
+			ptr->swapped |= 1u<<k;
 		}
 	}
-	return List;
 }
 
 static bool UsedOutside(LLVMValueRef I, VectorList* List)
@@ -474,464 +1802,3168 @@ static bool UsedOutside(LLVMValueRef I, VectorList* List)
 	return false;
 }
 
-static bool NotDefined(LLVMValueRef I, VectorList* List)
+//cost model: what a scalar op and its vector form cost on the target,
+//either as latency (cycles) or reciprocal throughput (cycles per op)
+#define COST_OPCODES (LLVMFreeze+1)
+#define COST_THROUGHPUT 0
+#define COST_LATENCY 1
+
+typedef struct {
+  int scalar[2];//one scalar op, indexed by COST_THROUGHPUT/COST_LATENCY
+  int vector[2];//one full vector register op, -1 when the target has none
+} OpCost;
+
+typedef struct {
+  LLVMOpcode opcode;
+  int isFloat;
+  OpCost cost;
+} CostEntry;
+
+typedef struct {
+  const char *name;
+  int vectorBits;
+  OpCost insert;//insertelement, per lane
+  OpCost extract;//extractelement, per lane
+  OpCost fma;//fused multiply-add, -1 when the target has none
+  const CostEntry *table;
+} CostTarget;
+
+//Nehalem class SSE4.2, 128 bit registers
+static const CostEntry SSECosts[] = {
+  {LLVMAdd,0,{{1,1},{1,1}}}, {LLVMSub,0,{{1,1},{1,1}}},
+  {LLVMAnd,0,{{1,1},{1,1}}}, {LLVMOr,0,{{1,1},{1,1}}}, {LLVMXor,0,{{1,1},{1,1}}},
+  {LLVMMul,0,{{1,3},{2,10}}},
+  {LLVMShl,0,{{1,1},{2,2}}}, {LLVMLShr,0,{{1,1},{2,2}}}, {LLVMAShr,0,{{1,1},{2,2}}},
+  {LLVMSDiv,0,{{10,26},{-1,-1}}}, {LLVMUDiv,0,{{10,26},{-1,-1}}},
+  {LLVMSRem,0,{{10,26},{-1,-1}}}, {LLVMURem,0,{{10,26},{-1,-1}}},
+  {LLVMICmp,0,{{1,1},{1,1}}}, {LLVMSelect,0,{{1,1},{2,2}}},
+  {LLVMLoad,0,{{1,4},{1,5}}}, {LLVMStore,0,{{1,1},{1,1}}},
+  {LLVMTrunc,0,{{0,0},{2,2}}}, {LLVMZExt,0,{{1,1},{1,1}}}, {LLVMSExt,0,{{1,1},{1,1}}},
+  {LLVMBitCast,0,{{0,0},{0,0}}}, {LLVMAlloca,0,{{0,0},{0,0}}},
+  {LLVMCall,0,{{10,10},{-1,-1}}}, {LLVMShuffleVector,0,{{1,1},{1,1}}},
+  {LLVMFAdd,1,{{1,3},{1,3}}}, {LLVMFSub,1,{{1,3},{1,3}}},
+  {LLVMFMul,1,{{1,5},{1,5}}}, {LLVMFDiv,1,{{7,14},{7,14}}},
+  {LLVMFRem,1,{{30,30},{-1,-1}}}, {LLVMFNeg,1,{{1,1},{1,1}}},
+  {LLVMFCmp,1,{{1,3},{1,3}}}, {LLVMSelect,1,{{1,1},{2,2}}},
+  {LLVMLoad,1,{{1,4},{1,5}}}, {LLVMStore,1,{{1,1},{1,1}}},
+  {LLVMSIToFP,1,{{1,4},{1,4}}}, {LLVMUIToFP,1,{{1,4},{4,8}}},
+  {LLVMFPToSI,1,{{1,4},{1,4}}}, {LLVMFPToUI,1,{{1,4},{4,8}}},
+  {LLVMFPTrunc,1,{{1,4},{1,4}}}, {LLVMFPExt,1,{{1,4},{1,4}}},
+  {LLVMBitCast,1,{{0,0},{0,0}}}, {LLVMAlloca,1,{{0,0},{0,0}}},
+  {LLVMCall,1,{{10,10},{-1,-1}}}, {LLVMShuffleVector,1,{{1,1},{1,1}}},
+  {0,0,{{0,0},{0,0}}}
+};
+
+//Haswell/Skylake class AVX2, 256 bit registers
+static const CostEntry AVX2Costs[] = {
+  {LLVMAdd,0,{{1,1},{1,1}}}, {LLVMSub,0,{{1,1},{1,1}}},
+  {LLVMAnd,0,{{1,1},{1,1}}}, {LLVMOr,0,{{1,1},{1,1}}}, {LLVMXor,0,{{1,1},{1,1}}},
+  {LLVMMul,0,{{1,3},{1,10}}},
+  {LLVMShl,0,{{1,1},{1,1}}}, {LLVMLShr,0,{{1,1},{1,1}}}, {LLVMAShr,0,{{1,1},{1,1}}},
+  {LLVMSDiv,0,{{6,26},{-1,-1}}}, {LLVMUDiv,0,{{6,26},{-1,-1}}},
+  {LLVMSRem,0,{{6,26},{-1,-1}}}, {LLVMURem,0,{{6,26},{-1,-1}}},
+  {LLVMICmp,0,{{1,1},{1,1}}}, {LLVMSelect,0,{{1,1},{1,2}}},
+  {LLVMLoad,0,{{1,4},{1,7}}}, {LLVMStore,0,{{1,1},{1,1}}},
+  {LLVMTrunc,0,{{0,0},{2,3}}}, {LLVMZExt,0,{{1,1},{1,3}}}, {LLVMSExt,0,{{1,1},{1,3}}},
+  {LLVMBitCast,0,{{0,0},{0,0}}}, {LLVMAlloca,0,{{0,0},{0,0}}},
+  {LLVMCall,0,{{10,10},{-1,-1}}}, {LLVMShuffleVector,0,{{1,1},{1,3}}},
+  {LLVMFAdd,1,{{1,4},{1,4}}}, {LLVMFSub,1,{{1,4},{1,4}}},
+  {LLVMFMul,1,{{1,4},{1,4}}}, {LLVMFDiv,1,{{4,11},{5,11}}},
+  {LLVMFRem,1,{{30,30},{-1,-1}}}, {LLVMFNeg,1,{{1,1},{1,1}}},
+  {LLVMFCmp,1,{{1,4},{1,4}}}, {LLVMSelect,1,{{1,1},{1,2}}},
+  {LLVMLoad,1,{{1,5},{1,7}}}, {LLVMStore,1,{{1,1},{1,1}}},
+  {LLVMSIToFP,1,{{1,5},{1,4}}}, {LLVMUIToFP,1,{{1,5},{3,8}}},
+  {LLVMFPToSI,1,{{1,6},{1,4}}}, {LLVMFPToUI,1,{{1,6},{3,8}}},
+  {LLVMFPTrunc,1,{{1,5},{1,7}}}, {LLVMFPExt,1,{{1,5},{1,7}}},
+  {LLVMBitCast,1,{{0,0},{0,0}}}, {LLVMAlloca,1,{{0,0},{0,0}}},
+  {LLVMCall,1,{{10,10},{-1,-1}}}, {LLVMShuffleVector,1,{{1,1},{1,3}}},
+  {0,0,{{0,0},{0,0}}}
+};
+
+static const CostTarget CostTargets[] = {
+  {"sse", 128, {{1,1},{1,1}}, {{1,1},{1,1}}, {{-1,-1},{-1,-1}}, SSECosts},
+  //the upper 128 bits go through vinsertf128/vextractf128
+  {"avx2",256, {{2,3},{2,3}}, {{1,3},{1,3}}, {{1,4},{1,4}}, AVX2Costs},
+  {NULL,0,{{0,0},{0,0}},{{0,0},{0,0}},{{0,0},{0,0}},NULL}
+};
+
+//the active model, filled from a target and then from the cost table file
+static struct {
+  const char *target;
+  int kind;//COST_THROUGHPUT or COST_LATENCY
+  OpCost insert;
+  OpCost extract;
+  OpCost fma;
+  OpCost op[COST_OPCODES][2];//[opcode][isFloat]
+} Cost;
+
+static const struct { const char *name; LLVMOpcode opcode; } OpcodeNames[] = {
+  {"add",LLVMAdd}, {"sub",LLVMSub}, {"mul",LLVMMul}, {"and",LLVMAnd}, {"or",LLVMOr}, {"xor",LLVMXor},
+  {"shl",LLVMShl}, {"lshr",LLVMLShr}, {"ashr",LLVMAShr},
+  {"sdiv",LLVMSDiv}, {"udiv",LLVMUDiv}, {"srem",LLVMSRem}, {"urem",LLVMURem},
+  {"fadd",LLVMFAdd}, {"fsub",LLVMFSub}, {"fmul",LLVMFMul}, {"fdiv",LLVMFDiv}, {"frem",LLVMFRem}, {"fneg",LLVMFNeg},
+  {"icmp",LLVMICmp}, {"fcmp",LLVMFCmp}, {"select",LLVMSelect}, {"call",LLVMCall},
+  {"load",LLVMLoad}, {"store",LLVMStore}, {"alloca",LLVMAlloca},
+  {"trunc",LLVMTrunc}, {"zext",LLVMZExt}, {"sext",LLVMSExt}, {"fptrunc",LLVMFPTrunc}, {"fpext",LLVMFPExt},
+  {"fptosi",LLVMFPToSI}, {"fptoui",LLVMFPToUI}, {"sitofp",LLVMSIToFP}, {"uitofp",LLVMUIToFP},
+  {"bitcast",LLVMBitCast}, {"shufflevector",LLVMShuffleVector},
+  {NULL,0}
+};
+
+static bool costSelectTarget(const char *name)
 {
-	//if I is in the list it is defined return false
-	if(valmap_check(List->visited,I)){
-		return false;	
+	const CostTarget *T;
+	const CostEntry *E;
+	int op, f;
+	for(T=CostTargets;T->name!=NULL;T++){
+		if(strcmp(T->name,name) == 0){
+			break;
+		}
+	}
+	if(T->name == NULL){
+		return false;
+	}
+	Cost.target = T->name;
+	Cost.insert = T->insert;
+	Cost.extract = T->extract;
+	Cost.fma = T->fma;
+	VectorBits = T->vectorBits;
+	//anything not in the table is a simple op that vectorizes 1:1
+	for(op=0;op<COST_OPCODES;op++){
+		for(f=0;f<2;f++){
+			OpCost simple = {{1,1},{1,1}};
+			Cost.op[op][f] = simple;
+		}
+	}
+	for(E=T->table;E->opcode!=0;E++){
+		Cost.op[E->opcode][E->isFloat] = E->cost;
 	}
 	return true;
 }
 
-static int CalcScore(VectorList* List)
+//read overrides, one per line ('#' starts a comment):
+//  target sse|avx2
+//  width <bits>
+//  insert|extract <throughput> <latency>
+//  fma <scalar throughput> <scalar latency> <vector throughput> <vector latency>
+//  <opcode> int|float <scalar throughput> <scalar latency> <vector throughput> <vector latency>
+static void costLoadTable(const char *path)
 {
-	int score = 0;
-	int i = 0;
-	LLVMValueRef I,J;
-	VectorPair *ptr = NULL;
-	//foreach pair (I,J) in L:
-	for(ptr = List->head; ptr!=NULL; ptr=ptr->next){
-		I = ptr->pair[0];	
-		J = ptr->pair[1];
-		//if TypeOf(I) is floating point kind:
-		if(IsFloat(I)){
-			score-=4;	
-		}else{
-			score--;	
-		}
-		//if I is ev er used outside of L:
-		if(UsedOutside(I,List)){
-			score++;	
+	FILE *fp = fopen(path,"r");
+	char line[256], word[32], kind[32], *hash;
+	OpCost c;
+	int i, n, lineNo = 0;
+	if(fp == NULL){
+		fprintf(stderr,"SLP: cannot open cost table %s\n",path);
+		return;
+	}
+	while(fgets(line,sizeof(line),fp)){
+		lineNo++;
+		if((hash = strchr(line,'#')) != NULL){
+			*hash = '\0';
 		}
-		//if J is ev er used outside of L:
-		if(UsedOutside(J,List)){
-			score++;	
+		if(sscanf(line,"%31s",word) != 1){
+			continue;
 		}
-
-		//for each operand,op, in I:
-		for(i=0;i<LLVMGetNumOperands(I);i++){
-			if(LLVMIsAInstruction(LLVMGetOperand(I,i))){
-				//if op is not defined by an instruction in L:
-				if(NotDefined(LLVMGetOperand(I,i),List)){
-					score++;	
-				}		
-			}
-		}
-		//for each operand,op, in J:
-		for(i=0;i<LLVMGetNumOperands(J);i++){
-			if(LLVMIsAInstruction(LLVMGetOperand(J,i))){
-				//if op is not defined by an instruction in L:
-				if(NotDefined(LLVMGetOperand(J,i),List)){
-					score++;	
+		if(strcmp(word,"target") == 0){
+			if(sscanf(line,"%*s %31s",kind) == 1 && costSelectTarget(kind)){
+				continue;
+			}
+		}else if(strcmp(word,"width") == 0){
+			if(sscanf(line,"%*s %d",&n) == 1 && n > 0){
+				VectorBits = n;
+				continue;
+			}
+		}else if(strcmp(word,"fma") == 0){
+			if(sscanf(line,"%*s %d %d %d %d",&c.scalar[0],&c.scalar[1],&c.vector[0],&c.vector[1]) == 4){
+				Cost.fma = c;
+				continue;
+			}
+		}else if(strcmp(word,"insert") == 0 || strcmp(word,"extract") == 0){
+			if(sscanf(line,"%*s %d %d",&c.scalar[0],&c.scalar[1]) == 2){
+				c.vector[0] = c.vector[1] = -1;
+				*(word[0] == 'i' ? &Cost.insert : &Cost.extract) = c;
+				continue;
+			}
+		}else{
+			for(i=0;OpcodeNames[i].name!=NULL;i++){
+				if(strcmp(OpcodeNames[i].name,word) == 0){
+					break;
 				}
 			}
+			if(OpcodeNames[i].name != NULL
+			   && sscanf(line,"%*s %31s %d %d %d %d",kind,&c.scalar[0],&c.scalar[1],&c.vector[0],&c.vector[1]) == 5
+			   && (strcmp(kind,"int") == 0 || strcmp(kind,"float") == 0)){
+				Cost.op[OpcodeNames[i].opcode][kind[0] == 'f'] = c;
+				continue;
+			}
 		}
+		fprintf(stderr,"SLP: %s:%d: ignoring malformed cost line\n",path,lineNo);
 	}
-	return score;
+	fclose(fp);
 }
 
-static bool IsTransformable(VectorPair* ptr)
+//a pack that has no vector form costs more than gathering its lanes, and
+//what is below it is found again from seeds of its own
+static bool NoVectorForm(LLVMValueRef I)
 {
-	LLVMValueRef I,J,K;
-	int i=0,flag = 0;
-	LLVMUseRef U;
-	I=ptr->pair[0];
-	J=ptr->pair[1];
+	int isFloat = IsFloat(I) || (!LLVMIsAAllocaInst(I) && LLVMGetNumOperands(I) > 0 && IsFloat(LLVMGetOperand(I,0)));
+	return !LLVMIsACallInst(I) && Cost.op[LLVMGetInstructionOpcode(I)][isFloat].vector[Cost.kind] < 0;
+}
 
-	LLVMBasicBlockRef BB = LLVMGetInstructionParent(I);
-	for(K=LLVMGetFirstInstruction(BB);K!=NULL;K=LLVMGetNextInstruction(K)){
-		flag = 0;
-		//check if position is dominated by all operands
-		for(i=0;i<LLVMGetNumOperands(I);i++){
-			if(LLVMIsAInstruction(LLVMGetOperand(I,i)) && LLVMIsAInstruction(LLVMGetOperand(J,i))){
-				if(!(dom(LLVMGetOperand(I,i),K)) || !(dom(LLVMGetOperand(J,i),K))){
-						flag = 1;
-						break;
-				}
-			}
+static int PackCost(VectorPair *ptr);
+static int OperandsCost(VectorList *List, VectorPair *ptr);
+
+//partial cost: a pack that can only be a leaf, none of its operands having a
+//vector form, and costs more than gathering its lanes would be cut off by
+//TrimTree anyway, so the tree does not grow into it. what it costs before
+//the rest of the tree is known is a lower bound, but for strided loads that
+//may share a wider load with another pack
+static bool LeafLoses(VectorList *List, LLVMValueRef *lanes, int n, int depth)
+{
+	VectorPair leaf;
+	LLVMValueRef op;
+	int i;
+	//lane 0 keeps its operand order, the other lanes are matched up to it
+	for(i=0;depth<MaxTreeDepth && i<LLVMGetNumOperands(lanes[0]);i++){
+		op = LLVMGetOperand(lanes[0],i);
+		if(LLVMIsAInstruction(op) && !NoVectorForm(op)){
+			return false;
 		}
-		//check if position dominates all uses
-		for(U = LLVMGetFirstUse(I);U!=NULL;U=LLVMGetNextUse(U)){
-				if(!dom(K,LLVMGetUser(U))){
-					flag =1;	
-					break;
-				}
+	}
+	if(LLVMIsALoadInst(lanes[0]) && MemoryPackKind(lanes,n) == MEM_STRIDED){
+		return false;
+	}
+	memset(&leaf,0,sizeof(leaf));
+	memcpy(leaf.pair,lanes,n*sizeof(LLVMValueRef));
+	leaf.lanes = n;
+	ReorderOperands(&leaf);
+	return PackCost(&leaf) + OperandsCost(List,&leaf) > n*Cost.insert.scalar[Cost.kind];
+}
+
+//the tree of packs below lanes, depth first with an explicit stack so deep
+//expression trees can not overflow the C stack. a pack MaxTreeDepth below
+//the root is a leaf, and the tree stops growing at MaxTreeNodes packs or
+//when the block has used up its packs
+static VectorList* CollectIsomorphicInsts(VectorList* oldList, LLVMValueRef *lanes, int n)
+{
+	VectorList* List = NULL;
+	VectorPair *ptr, *child;
+	LLVMValueRef ops[MAX_LANES];
+	worklist_t work;
+	int i = 0, k = 0, allInst;
+	
+	//check params
+	for(k=0;k<n;k++){
+		if(lanes[k] == NULL){
+			return NULL;
 		}
-		for(U = LLVMGetFirstUse(J);U!=NULL;U=LLVMGetNextUse(U)){
-				if(!dom(K,LLVMGetUser(U))){
-					flag = 1;
-					break;
-				}
+	}
+	//if shouldvectorize every lane against the others
+	if(!ShouldVectorizePack(lanes,n))
+	{
+		return NULL;
+	}
+	List = oldList;
+	if(List == NULL){
+		List = create();	
+	}
+	//if any lane already in list return list
+	for(k=0;k<n;k++){
+		if(valmap_check(List->visited,lanes[k])){
+			return List;	
 		}
-		if(flag == 0){
-			//this position dominates all uses and is dominated by all operands
-			LLVMPositionBuilderBefore(Builder,K);
-			return true;
+	}
+	ptr = addPair(List,lanes,n);
+	Ctx->packsLeft--;
+	if(Ctx->look == NULL){
+		Ctx->look = (LookAheadEntry*) calloc(LOOKAHEAD_CACHE,sizeof(LookAheadEntry));
+	}
+	Ctx->build++;
+	ReorderOperands(ptr);
+
+	//the stack holds lane 0 of the packs whose operands are not all seen yet
+	work = worklist_create();
+	worklist_insert(work,ptr->pair[0]);
+	while(!worklist_empty(work)){
+		ptr = (VectorPair*)valmap_find(List->visited,worklist_pop(work));
+		if(ptr->depth >= MaxTreeDepth || ptr->cursor >= LLVMGetNumOperands(ptr->pair[0])){
+			continue;
+		}
+		i = ptr->cursor++;
+		worklist_insert(work,ptr->pair[0]);
+		//a PHI pack grows around the back edge, never into the preheader
+		if(LLVMIsAPHINode(ptr->pair[0]) && LLVMGetIncomingBlock(ptr->pair[0],i) != LLVMGetInstructionParent(ptr->pair[0])){
+			continue;
+		}
+		//if operands are instructions check if they can be added to the list
+		allInst = 1;
+		for(k=0;k<n;k++){
+			ops[k] = PackOperand(ptr,k,i);
+			if(!LLVMIsAInstruction(ops[k]) || valmap_check(List->visited,ops[k])){
+				allInst = 0;
+			}
 		}
+		if(!allInst || List->size >= MaxTreeNodes || Ctx->packsLeft <= 0 || !IsIsomorphicPack(ops,n) ||
+		   NoVectorForm(ops[0]) || LeafLoses(List,ops,n,ptr->depth+1) || !ShouldVectorizePack(ops,n)){
+			continue;
+		}
+		child = addPair(List,ops,n);
+		Ctx->packsLeft--;
+		ReorderOperands(child);
+		child->depth = ptr->depth+1;
+		child->parent = ptr;
+		worklist_insert(work,child->pair[0]);
 	}
-	return false;
+	worklist_destroy(work);
+	return List;
 }
-//Note:
-//isomorphic pairs are transformable if the vector can be placed such that
-//it dominates all uses of pair and it is dominated by all operands of the pair
 
-//using gcc:extension variable length array
-static LLVMValueRef Build(LLVMValueRef I,LLVMOpcode opcode,int size, LLVMValueRef ops[size],valmap_t op2vec)
+//vector registers a pack of n lanes occupies, by the widest type it touches
+static int RegistersFor(LLVMValueRef I, int n)
 {
-	int i = 0;
-	LLVMValueRef newinsn = NULL;
-	LLVMValueRef operands[size];
-	for(i=0;i<LLVMGetNumOperands(I);i++){
-		operands[i] = LLVMGetOperand(I,i);	
+	LLVMTypeRef T = LLVMTypeOf(I);
+	unsigned long long bits = 0;
+	int regs;
+	if(LLVMGetTypeKind(T) != LLVMVoidTypeKind && LLVMGetTypeKind(T) != LLVMPointerTypeKind){
+		bits = LayoutQuery(LLVMSizeOfTypeInBits,T);
+	}
+	//stored values, compared values and cast sources
+	if(LLVMGetNumOperands(I) > 0 && !LLVMIsAAllocaInst(I)){
+		T = LLVMTypeOf(LLVMGetOperand(I,0));
+		if(LLVMGetTypeKind(T) != LLVMPointerTypeKind && LLVMGetTypeKind(T) != LLVMLabelTypeKind
+		   && LayoutQuery(LLVMSizeOfTypeInBits,T) > bits){
+			bits = LayoutQuery(LLVMSizeOfTypeInBits,T);
+		}
 	}
+	regs = (int)((n*bits + VectorBits - 1)/VectorBits);
+	return regs > 0 ? regs : 1;
+}
 
-	switch(opcode){
-		case LLVMAdd:
-				newinsn = LLVMBuildAdd (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMFAdd: 	
-				newinsn = LLVMBuildFAdd (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMSub:	
-				newinsn = LLVMBuildSub (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMFSub: 	
-				newinsn = LLVMBuildFSub (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMMul: 	
-				newinsn = LLVMBuildMul (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMFMul: 	
-				newinsn = LLVMBuildFMul (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMUDiv: 	
-				newinsn = LLVMBuildUDiv (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMSDiv: 	
-				newinsn = LLVMBuildSDiv (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMFDiv: 
-				newinsn = LLVMBuildFDiv (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;			
-		case LLVMURem: 	
-				newinsn = LLVMBuildURem (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMSRem: 	
-				newinsn = LLVMBuildSRem (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMFRem: 	
-				newinsn = LLVMBuildFRem (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMShl:	
-				newinsn = LLVMBuildShl (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMLShr: 	
-				newinsn = LLVMBuildLShr (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMAShr: 	
-				newinsn = LLVMBuildAShr (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMAnd: 	
-				newinsn = LLVMBuildAnd (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMOr: 	
-				newinsn = LLVMBuildOr (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMXor: 	
-				newinsn = LLVMBuildXor (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[1]), "");
-				break;
-		case LLVMAlloca: 	
-				newinsn = LLVMBuildAlloca (Builder, LLVMPointerType(LLVMTypeOf((LLVMValueRef)valmap_find(op2vec,operands[0])),0), "");
-				break;
-		case LLVMLoad:
-				newinsn = LLVMBuildLoad (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),"");
-				break;
-		case LLVMStore: 	
-				newinsn = LLVMBuildStore (Builder, (LLVMValueRef)valmap_find(op2vec,operands[0]),(LLVMValueRef)valmap_find(op2vec,operands[0]));
-				break;
-//		case LLVMGetElementPtr:
-//		case LLVMTrunc:
-//		case LLVMZExt: 	
-//		case LLVMSExt: 	
-//		case LLVMFPToUI: 	
-//		case LLVMFPToSI: 	
-//		case LLVMUIToFP: 	
-//		case LLVMSIToFP: 	
-//		case LLVMFPTrunc: 	
-//		case LLVMFPExt:
-//		case LLVMPtrToInt: 	
-//		case LLVMIntToPtr:	
-//		case LLVMBitCast:
+//cost of the vector form of a pack minus the cost of its scalar lanes,
+//float ops are the ones producing or consuming a floating point value
+//narrowing: integer ops between zexts and a trunc only decide the low bits
+//the trunc keeps, so they can run on narrower lanes, more per register.
+//an lshr also reads the bits it shifts down, it needs its input exact
+#define MAX_NARROW 32
+
+typedef struct {
+  VectorPair *packs[MAX_NARROW];
+  int bound[MAX_NARROW];//low bits the values of the pack may have set
+  int count;
+  int need;//width the lshrs need to see their whole input
+  int width;//width of the values before narrowing
+} NarrowRegion;
+
+//pack of List that supplies operand i of ptr lane for lane, NULL if none
+static VectorPair *OperandPack(VectorList *List, VectorPair *ptr, int i)
+{
+	VectorPair *src;
+	int k;
+	if(!valmap_check(List->visited,PackOperand(ptr,0,i))){
+		return NULL;
+	}
+	src = (VectorPair*)valmap_find(List->visited,PackOperand(ptr,0,i));
+	for(k=0;k<ptr->lanes;k++){
+		if(src->lanes != ptr->lanes || src->pair[k] != PackOperand(ptr,k,i)){
+			return NULL;
+		}
+	}
+	return src;
+}
+
+//bits of the largest constant operand i of the lanes, -1 if one is not a constant
+static int ConstantBits(VectorPair *ptr, int i, int width)
+{
+	unsigned long long v;
+	int k, bits = 0, b;
+	for(k=0;k<ptr->lanes;k++){
+		if(!LLVMIsAConstantInt(PackOperand(ptr,k,i))){
+			return -1;
+		}
+		v = LLVMConstIntGetZExtValue(PackOperand(ptr,k,i));
+		for(b=0;b<width && (v>>b) != 0;b++);
+		if(b > bits){
+			bits = b;
+		}
+	}
+	return bits;
+}
+
+//adds ptr and the packs below it to R, returns the bound of its values or -1
+static int NarrowBound(VectorList *List, NarrowRegion *R, VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0];
+	VectorPair *src;
+	int b[2], i, k, bound, me;
+	for(k=0;k<R->count;k++){
+		if(R->packs[k] == ptr){
+			return R->bound[k];
+		}
+	}
+	//compare widths, creating the type here would race with the workers
+	//that build types under ModuleLock
+	if(R->count == MAX_NARROW || LLVMGetTypeKind(LLVMTypeOf(I)) != LLVMIntegerTypeKind
+	   || LLVMGetIntTypeWidth(LLVMTypeOf(I)) != (unsigned)R->width){
+		return -1;
+	}
+	me = R->count++;
+	R->packs[me] = ptr;
+	if(LLVMIsAZExtInst(I)){
+		R->bound[me] = LLVMGetIntTypeWidth(LLVMTypeOf(LLVMGetOperand(I,0)));
+		return R->bound[me];
+	}
+	switch(LLVMGetInstructionOpcode(I)){
+		case LLVMAdd: case LLVMSub: case LLVMMul: case LLVMAnd: case LLVMOr: case LLVMXor:
+		case LLVMShl: case LLVMLShr:
+			break;
+		default:
+			return -1;
+	}
+	for(i=0;i<2;i++){
+		src = OperandPack(List,ptr,i);
+		b[i] = src ? NarrowBound(List,R,src) : ConstantBits(ptr,i,R->width);
+		if(b[i] < 0){
+			return -1;
+		}
+	}
+	switch(AltLane(ptr) ? LLVMSub : LLVMGetInstructionOpcode(I)){
+		case LLVMAdd:
+			bound = (b[0] > b[1] ? b[0] : b[1]) + 1;
+			break;
+		case LLVMMul:
+			bound = b[0] + b[1];
+			break;
+		case LLVMAnd:
+			bound = b[0] < b[1] ? b[0] : b[1];
+			break;
+		case LLVMOr:
+		case LLVMXor:
+			bound = b[0] > b[1] ? b[0] : b[1];
+			break;
+		case LLVMShl:
+		case LLVMLShr:
+			//shift amounts have to be constants
+			if(ConstantBits(ptr,1,R->width) < 0){
+				return -1;
+			}
+			for(k=0,bound=b[0];k<ptr->lanes;k++){
+				b[1] = (int)LLVMConstIntGetZExtValue(PackOperand(ptr,k,1));
+				if(LLVMGetInstructionOpcode(I) == LLVMShl && b[0] + b[1] > bound){
+					bound = b[0] + b[1];
+				}
+				//shifting by the width or more gives poison
+				if(b[1] >= R->need){
+					R->need = b[1]+1;
+				}
+			}
+			//a right shift brings the high bits down, they all count
+			if(LLVMGetInstructionOpcode(I) == LLVMLShr && b[0] > R->need){
+				R->need = b[0];
+			}
 			break;
 		default:
-			printf("Vectorization not supported for this instruction\n");
+			//a difference may wrap around, all its bits count
+			bound = R->width;
 			break;
 	}
-	return newinsn;
+	R->bound[me] = bound < R->width ? bound : R->width;
+	return R->bound[me];
+}
+
+//sets the width the packs under the trunc pack T can be computed in
+static void NarrowBelow(VectorList *List, VectorPair *T)
+{
+	NarrowRegion R;
+	VectorPair *P, *user;
+	LLVMUseRef U;
+	int k, j, l, w, dest;
+	P = OperandPack(List,T,0);
+	if(P == NULL){
+		return;
+	}
+	R.count = 0;
+	R.need = 0;
+	R.width = LLVMGetIntTypeWidth(LLVMTypeOf(LLVMGetOperand(T->pair[0],0)));
+	dest = LLVMGetIntTypeWidth(LLVMTypeOf(T->pair[0]));
+	if(NarrowBound(List,&R,P) < 0){
+		return;
+	}
+	//the wide values must not be needed by anything but the region
+	for(j=0;j<R.count;j++){
+		for(k=0;k<R.packs[j]->lanes;k++){
+			for(U=LLVMGetFirstUse(R.packs[j]->pair[k]);U!=NULL;U=LLVMGetNextUse(U)){
+				if(!valmap_check(List->visited,LLVMGetUser(U))){
+					return;
+				}
+				user = (VectorPair*)valmap_find(List->visited,LLVMGetUser(U));
+				for(l=0;l<R.count && R.packs[l] != user;l++);
+				if(user != T && l == R.count){
+					return;
+				}
+			}
+		}
+	}
+	for(w=8;w<dest || w<R.need;w*=2);
+	if(w >= R.width){
+		return;
+	}
+	for(j=0;j<R.count;j++){
+		R.packs[j]->bits = w;
+	}
+	T->bits = w;
+}
+
+//the vector ops of pack ptr on lanes of its narrowed width, or of its own
+static int PackRegisters(VectorPair *ptr)
+{
+	int regs;
+	if(ptr->bits == 0){
+		return RegistersFor(ptr->pair[0],ptr->lanes);
+	}
+	regs = (ptr->lanes*ptr->bits + VectorBits - 1)/VectorBits;
+	return regs > 0 ? regs : 1;
+}
+
+//a narrowed zext or trunc between equal widths is no instruction at all
+static bool NarrowIsNoop(VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0];
+	if(ptr->bits == 0){
+		return false;
+	}
+	if(LLVMIsAZExtInst(I)){
+		return LLVMGetIntTypeWidth(LLVMTypeOf(LLVMGetOperand(I,0))) == (unsigned)ptr->bits;
+	}
+	if(LLVMIsATruncInst(I)){
+		return LLVMGetIntTypeWidth(LLVMTypeOf(I)) == (unsigned)ptr->bits;
+	}
+	return false;
+}
+
+static int PackCost(VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0];
+	int isFloat = IsFloat(I) || (!LLVMIsAAllocaInst(I) && IsFloat(LLVMGetOperand(I,0)));
+	OpCost *c = &Cost.op[LLVMGetInstructionOpcode(I)][isFloat], *a = c;
+	LLVMValueRef A = AltLane(ptr);
+	int n = ptr->lanes, k, cost, span;
+	if(A){
+		a = &Cost.op[LLVMGetInstructionOpcode(A)][isFloat];
+	}
+	if(NarrowIsNoop(ptr)){
+		return -n*c->scalar[Cost.kind];
+	}
+	if(LLVMIsACallInst(I)){
+		//a scalar intrinsic costs per lane what its vector form costs per register
+		const MathEntry *M = MathLookup(I,n);
+		if(M != NULL){
+			return PackRegisters(ptr)*M->cost - n*(LLVMGetIntrinsicID(LLVMGetCalledValue(I)) ? M->cost : c->scalar[Cost.kind]);
+		}
+	}
+	if(PointerOperand(I) >= 0 && MemoryPackKind(ptr->pair,n) == MEM_STRIDED){
+		//one access over the records the lanes are spread across and a
+		//shuffle between it and the lanes, see BuildStrided
+		span = (n-1)*PackStride(ptr)+1;
+		cost = RegistersFor(I,span)*Cost.op[LLVMShuffleVector][isFloat].vector[Cost.kind];
+		if(LLVMIsALoadInst(I)){
+			cost += RegistersFor(I,span)*c->vector[Cost.kind];
+		}else if(VectorBits >= 256){
+			//a masked store leaves the other fields alone, about two stores on AVX
+			cost += 2*RegistersFor(I,span)*c->vector[Cost.kind];
+		}else{
+			//without one the backend stores the lanes one by one
+			cost += n*(Cost.extract.scalar[Cost.kind]+c->scalar[Cost.kind]);
+		}
+		return cost - n*c->scalar[Cost.kind];
+	}
+	if(c->vector[Cost.kind] < 0 || a->vector[Cost.kind] < 0){
+		//no vector form: the lanes run scalar between an extract and an insert
+		return n*(Cost.extract.scalar[Cost.kind]+Cost.insert.scalar[Cost.kind]);
+	}
+	if(A){
+		//both operations on all lanes and a blend that picks each lane
+		cost = PackRegisters(ptr)*(c->vector[Cost.kind] + a->vector[Cost.kind] +
+				Cost.op[LLVMShuffleVector][isFloat].vector[Cost.kind]);
+		for(k=0;k<n;k++){
+			cost -= (LLVMGetInstructionOpcode(ptr->pair[k]) == LLVMGetInstructionOpcode(I) ? c : a)->scalar[Cost.kind];
+		}
+		return cost;
+	}
+	return PackRegisters(ptr)*c->vector[Cost.kind] - n*c->scalar[Cost.kind];
+}
+
+//insertelements that build operand i of a pack, nothing when a pack of List supplies it
+//or all lanes are constant, an insert and a shuffle when all lanes hold one value
+//a select whose lanes all test the same i1 picks whole vectors with it
+static bool SharedCondition(VectorPair *ptr, int i)
+{
+	int k;
+	if(i != 0 || !LLVMIsASelectInst(ptr->pair[0])){
+		return false;
+	}
+	for(k=1;k<ptr->lanes && LLVMGetOperand(ptr->pair[k],0) == LLVMGetOperand(ptr->pair[0],0);k++);
+	return k == ptr->lanes;
+}
+
+static int GatherCost(VectorList *List, VectorPair *ptr, int i)
+{
+	VectorPair *src = NULL;
+	LLVMValueRef op, op0 = PackOperand(ptr,0,i);
+	LLVMValueRef lanes[MAX_LANES];
+	void *srcs[2];
+	int mask[MAX_LANES];
+	int k, nsrc, width, allConst = 1, splat = 1, cost = 0;
+	if(valmap_check(List->visited,op0)){
+		src = (VectorPair*)valmap_find(List->visited,op0);
+	}
+	for(k=0;k<ptr->lanes;k++){
+		op = PackOperand(ptr,k,i);
+		if(!LLVMIsAConstant(op)){
+			allConst = 0;
+			cost += Cost.insert.scalar[Cost.kind];
+		}
+		if(op != op0){
+			splat = 0;
+		}
+		if(src && (src->lanes != ptr->lanes || src->pair[k] != op)){
+			src = NULL;
+		}
+	}
+	if(src || allConst || SharedCondition(ptr,i)){
+		return 0;
+	}
+	//lanes some vector holds already take at most one shuffle
+	for(k=0;k<ptr->lanes;k++){
+		lanes[k] = PackOperand(ptr,k,i);
+	}
+	nsrc = FindLaneSources(List,NULL,NULL,lanes,ptr->lanes,srcs,&width,mask);
+	if(nsrc){
+		return IsIdentityReuse(nsrc,width,mask,ptr->lanes) ? 0 : Cost.op[LLVMShuffleVector][IsFloat(op0)].vector[Cost.kind];
+	}
+	if(splat){
+		cost = Cost.insert.scalar[Cost.kind] + Cost.op[LLVMShuffleVector][IsFloat(op0)].vector[Cost.kind];
+	}
+	//lanes that are vectorized themselves have to be extracted first
+	for(k=0;k<ptr->lanes;k++){
+		if(valmap_check(List->visited,PackOperand(ptr,k,i))){
+			cost += Cost.extract.scalar[Cost.kind];
+			if(splat){
+				break;
+			}
+		}
+	}
+	return cost;
+}
+
+//strided loads of one list that read the same records, like the x and
+//the y packs of an array of points
+static bool SameGroup(VectorPair *a, VectorPair *b)
+{
+	MemAddr A,B;
+	long size, stride;
+	if(!LLVMIsALoadInst(a->pair[0]) || !LLVMIsALoadInst(b->pair[0]) || a->lanes != b->lanes ||
+	   LLVMTypeOf(a->pair[0]) != LLVMTypeOf(b->pair[0])){
+		return false;
+	}
+	if(MemoryPackKind(a->pair,a->lanes) != MEM_STRIDED || MemoryPackKind(b->pair,b->lanes) != MEM_STRIDED){
+		return false;
+	}
+	stride = PackStride(a);
+	if(PackStride(b) != stride){
+		return false;
+	}
+	DecomposeAddress(LLVMGetOperand(a->pair[0],0),&A);
+	DecomposeAddress(LLVMGetOperand(b->pair[0],0),&B);
+	size = LayoutQuery(LLVMABISizeOfType,LLVMTypeOf(a->pair[0]));
+	return A.base == B.base && A.index == B.index && A.scale == B.scale &&
+	       (A.offset-B.offset) % size == 0 && labs(A.offset-B.offset) < stride*size;
+}
+
+//the interleave group of strided load ptr: its first pack in List, which
+//the records are loaded for, and the first and last element they span,
+//counted from lane 0 of ptr. Every element read lies between two lanes,
+//so the one wide load of the group stays inside the object
+static VectorPair *GroupSpan(VectorList *List, VectorPair *ptr, long *lo, long *hi)
+{
+	VectorPair *first, *q;
+	MemAddr A,B;
+	long size = LayoutQuery(LLVMABISizeOfType,LLVMTypeOf(ptr->pair[0])), d;
+	for(first=List->head;first!=NULL && !SameGroup(first,ptr);first=first->next);
+	DecomposeAddress(LLVMGetOperand(ptr->pair[0],0),&A);
+	*lo = 0;
+	*hi = (ptr->lanes-1)*PackStride(ptr);
+	for(q=List->head;q!=NULL;q=q->next){
+		if(q == ptr || !SameGroup(q,first)){
+			continue;
+		}
+		DecomposeAddress(LLVMGetOperand(q->pair[0],0),&B);
+		d = (B.offset-A.offset)/size;
+		if(d < *lo){
+			*lo = d;
+		}
+		if(d+(ptr->lanes-1)*PackStride(ptr) > *hi){
+			*hi = d+(ptr->lanes-1)*PackStride(ptr);
+		}
+	}
+	return first;
+}
+
+//the group loads its records once for its first pack, PackCost charged
+//every pack a load of its own lanes
+static int GroupLoadCost(VectorList *List, VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0];
+	int load = Cost.op[LLVMLoad][IsFloat(I)].vector[Cost.kind];
+	long lo, hi;
+	int cost = -RegistersFor(I,(ptr->lanes-1)*PackStride(ptr)+1)*load;
+	if(GroupSpan(List,ptr,&lo,&hi) == ptr){
+		cost += RegistersFor(I,hi-lo+1)*load;
+	}
+	return cost;
+}
+
+//whether the fast-math flags of I include flag
+static bool HasFastMath(LLVMValueRef I, unsigned flag)
+{
+	return (LLVMGetFastMathFlags(I) & flag) != 0;
+}
+
+//operand of fadd or fsub pack ptr that is an fmul pack of List the two can
+//fuse with, -1 if none: every lane of the fmul is used by its lane of ptr
+//only and the fast-math flags of both allow contracting them
+static int FusedOperand(VectorList *List, VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0], M;
+	VectorPair *src;
+	LLVMUseRef U;
+	int i, k;
+	if(Cost.fma.vector[Cost.kind] < 0 || AltLane(ptr) ||
+	   (LLVMGetInstructionOpcode(I) != LLVMFAdd && LLVMGetInstructionOpcode(I) != LLVMFSub)){
+		return -1;
+	}
+	for(k=0;k<ptr->lanes;k++){
+		if(!HasFastMath(ptr->pair[k],LLVMFastMathAllowContract)){
+			return -1;
+		}
+	}
+	for(i=0;i<2;i++){
+		M = PackOperand(ptr,0,i);
+		if(!LLVMIsAInstruction(M) || LLVMGetInstructionOpcode(M) != LLVMFMul || !valmap_check(List->visited,M)){
+			continue;
+		}
+		src = (VectorPair*)valmap_find(List->visited,M);
+		for(k=0;k<ptr->lanes && src->lanes == ptr->lanes && src->pair[k] == PackOperand(ptr,k,i);k++){
+			U = LLVMGetFirstUse(src->pair[k]);
+			if(!HasFastMath(src->pair[k],LLVMFastMathAllowContract) || U == NULL || LLVMGetNextUse(U) != NULL){
+				break;
+			}
+		}
+		if(k == ptr->lanes){
+			return i;
+		}
+	}
+	return -1;
+}
+
+//one fused multiply-add per register instead of an fmul and an fadd; the
+//backend fuses the scalar lanes under the same flags, so they are counted
+//fused too. An fsub negates the operand it does not take from the fmul
+static int FusedCost(VectorList *List, VectorPair *ptr)
+{
+	int i = FusedOperand(List,ptr), regs = PackRegisters(ptr), n = ptr->lanes, cost;
+	if(i < 0){
+		return 0;
+	}
+	cost = regs*(Cost.fma.vector[Cost.kind] - Cost.op[LLVMFMul][1].vector[Cost.kind] - Cost.op[LLVMFAdd][1].vector[Cost.kind]);
+	if(LLVMGetInstructionOpcode(ptr->pair[0]) == LLVMFSub){
+		cost += regs*Cost.op[LLVMFNeg][1].vector[Cost.kind];
+	}
+	if(Cost.fma.scalar[Cost.kind] >= 0){
+		cost -= n*(Cost.fma.scalar[Cost.kind] - Cost.op[LLVMFMul][1].scalar[Cost.kind] - Cost.op[LLVMFAdd][1].scalar[Cost.kind]);
+	}
+	return cost;
+}
+
+//what building the operands of ptr costs
+static int OperandsCost(VectorList *List, VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0];
+	int i, cost = 0;
+	//for each operand position not produced by a pack of L:
+	for(i=0;i<LLVMGetNumOperands(I);i++){
+		//addresses are never gathered, the access is wide or stays scalar
+		if(i == PointerOperand(I) || i == CalleeOperand(I)){
+			continue;
+		}
+		//a loop PHI starts from a vector gathered once before the loop
+		if(LLVMIsAPHINode(I) && LLVMGetIncomingBlock(I,i) != LLVMGetInstructionParent(I)){
+			continue;
+		}
+		cost += GatherCost(List,ptr,i);
+	}
+	return cost;
+}
+
+//what vectorizing ptr alone adds to the score of List
+static int PackScore(VectorList *List, VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0];
+	int score = 0;
+	int k;
+	//the vector op against its scalar lanes on the target
+	score += PackCost(ptr);
+	if(LLVMIsALoadInst(I) && MemoryPackKind(ptr->pair,ptr->lanes) == MEM_STRIDED){
+		score += GroupLoadCost(List,ptr);
+	}
+	score += FusedCost(List,ptr);
+	//a vector alloca hands out lanes with a GEP, anything else extracts
+	if(LLVMIsAAllocaInst(I)){
+		return score;
+	}
+	for(k=0;k<ptr->lanes;k++){
+		//if lane is ever used outside of L:
+		if(UsedOutside(ptr->pair[k],List)){
+			score += Cost.extract.scalar[Cost.kind];
+		}
+	}
+	return score + OperandsCost(List,ptr);
+}
+
+static int CalcScore(VectorList* List)
+{
+	int score = 0;
+	VectorPair *ptr = NULL;
+	for(ptr = List->head; ptr!=NULL; ptr=ptr->next){
+		ptr->bits = 0;
+	}
+	for(ptr = List->head; ptr!=NULL; ptr=ptr->next){
+		if(LLVMIsATruncInst(ptr->pair[0]) && LLVMGetTypeKind(LLVMTypeOf(ptr->pair[0])) == LLVMIntegerTypeKind){
+			NarrowBelow(List,ptr);
+		}
+	}
+	//foreach pack in L:
+	for(ptr = List->head; ptr!=NULL; ptr=ptr->next){
+		score += PackScore(List,ptr);
+	}
+	return score;
+}
+
+//true if ptr or one of the packs above it is in cut, keyed by lane 0
+static bool IsCut(VectorPair *ptr, valmap_t cut)
+{
+	for(;ptr!=NULL;ptr=ptr->parent){
+		if(valmap_check(cut,ptr->pair[0])){
+			return true;
+		}
+	}
+	return false;
+}
+
+//copy of List without the packs of cut and everything below them,
+//the lanes of those stay scalar and are gathered where the tree reads them
+static VectorList *CopyUncut(VectorList *List, valmap_t cut)
+{
+	VectorList *new = create();
+	VectorPair *ptr, *copy;
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		if(IsCut(ptr,cut)){
+			new->trimmed++;
+			continue;
+		}
+		copy = addPair(new,ptr->pair,ptr->lanes);
+		copy->insertAt0 = ptr->insertAt0;
+		copy->swapped = ptr->swapped;
+		copy->depth = ptr->depth;
+		copy->cursor = ptr->cursor;
+	}
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		if(ptr->parent && valmap_check(new->visited,ptr->pair[0])){
+			copy = (VectorPair*)valmap_find(new->visited,ptr->pair[0]);
+			copy->parent = (VectorPair*)valmap_find(new->visited,ptr->parent->pair[0]);
+		}
+	}
+	new->trimmed += List->trimmed;
+	new->score = CalcScore(new);
+	return new;
+}
+
+//deepest packs first, so that a pack is done before its parent
+static int DeeperFirst(const void *x, const void *y)
+{
+	return (*(VectorPair*const*)y)->depth - (*(VectorPair*const*)x)->depth;
+}
+
+//throttle the tree of a scored List: a subtree that costs more than
+//gathering its lanes into the operand of its parent is cut off, bottom up.
+//Returns the cheaper of List and its trimmed copy, the other is destroyed
+static VectorList *TrimTree(VectorList *List)
+{
+	VectorPair **packs, *ptr, *src;
+	VectorList *trimmed;
+	valmap_t cut;
+	int n = 0, i, k, l, gather, ncut = 0;
+	if(List->size < 3){
+		return List;
+	}
+	packs = (VectorPair**) malloc(List->size*sizeof(VectorPair*));
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		ptr->subtree = PackScore(List,ptr);
+		packs[n++] = ptr;
+	}
+	qsort(packs,n,sizeof(VectorPair*),DeeperFirst);
+	cut = poolMap();
+	for(k=0;k<n;k++){
+		ptr = packs[k];
+		//what the pack pays for operands whose packs were cut off below it,
+		//its own or ones it shares with another part of the tree
+		gather = ptr->lanes*Cost.insert.scalar[Cost.kind];
+		for(i=0;i<LLVMGetNumOperands(ptr->pair[0]);i++){
+			if(i == PointerOperand(ptr->pair[0]) || !valmap_check(List->visited,PackOperand(ptr,0,i))){
+				continue;
+			}
+			src = (VectorPair*)valmap_find(List->visited,PackOperand(ptr,0,i));
+			for(l=0;l<ptr->lanes && src->lanes == ptr->lanes && src->pair[l] == PackOperand(ptr,l,i);l++);
+			if(l == ptr->lanes && IsCut(src,cut)){
+				ptr->subtree += gather;
+			}
+		}
+		if(ptr->parent == NULL){
+			continue;
+		}
+		//the parent gathers the lanes instead when this subtree stays scalar
+		if(gather < ptr->subtree){
+			valmap_insert(cut,ptr->pair[0],(void*)1);
+			ncut++;
+		}else{
+			ptr->parent->subtree += ptr->subtree;
+		}
+	}
+	free(packs);
+	if(ncut == 0){
+		poolMapRelease(cut);
+		return List;
+	}
+	//the estimate ignores lanes the cut part now needs extracted, score it for real
+	trimmed = CopyUncut(List,cut);
+	poolMapRelease(cut);
+	if(trimmed->size < 2 || trimmed->score >= List->score){
+		destroy(trimmed);
+		return List;
+	}
+	destroy(List);
+	return trimmed;
+}
+
+//true if I may write memory that a moved load or store could observe
+static bool MayWriteMemory(LLVMValueRef I)
+{
+	switch(LLVMGetInstructionOpcode(I)){
+		case LLVMCall:
+			return PureCallee(I) == NULL;
+		case LLVMStore:
+		case LLVMInvoke:
+		case LLVMFence:
+		case LLVMAtomicCmpXchg:
+		case LLVMAtomicRMW:
+		case LLVMVAArg:
+			return true;
+		default:
+			return false;
+	}
+}
+
+static bool InPack(VectorPair *ptr, LLVMValueRef I)
+{
+	int k;
+	for(k=0;k<ptr->lanes;k++){
+		if(ptr->pair[k] == I){
+			return true;
+		}
+	}
+	return false;
+}
+
+//true when X and Y access memory in a way that fixes their order
+static bool MemoryConflict(LLVMValueRef X, LLVMValueRef Y)
+{
+	bool wx = MayWriteMemory(X), wy = MayWriteMemory(Y);
+	if(!(wx || LLVMIsALoadInst(X)) || !(wy || LLVMIsALoadInst(Y)) || !(wx || wy)){
+		return false;
+	}
+	return MayAlias(X,Y);
+}
+
+//a load or store lane must not be moved across memory accesses that may
+//alias it: stores for a load, loads and stores for a store. instructions
+//in sunk go below the vector instruction and are not crossed
+static bool MemoryMoveIsSafe(VectorPair* ptr, LLVMValueRef K, valmap_t sunk)
+{
+	LLVMValueRef L,X,from,to;
+	int k;
+	bool isStore = LLVMIsAStoreInst(ptr->pair[0]) != NULL;
+	if(!isStore && !LLVMIsALoadInst(ptr->pair[0])){
+		return true;
+	}
+	for(k=0;k<ptr->lanes;k++){
+		L = ptr->pair[k];
+		//the vector takes the place of the lane K
+		if(L == K){
+			continue;
+		}
+		//the vector goes right before K, so K itself is crossed when it comes first
+		from = dominBB(L,K) ? LLVMGetNextInstruction(L) : K;
+		to = dominBB(L,K) ? K : L;
+		for(X=from;X!=NULL && X!=to;X=LLVMGetNextInstruction(X)){
+			if(InPack(ptr,X) || valmap_check(sunk,X)){
+				continue;
+			}
+			if((MayWriteMemory(X) || (isStore && LLVMIsALoadInst(X))) && MayAlias(X,L)){
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+//collects in sunk the instructions that have to go below a vector
+//instruction placed before K: users of the lanes above K and everything that
+//depends on them through values or memory. false when one of those is needed
+//by the pack, or the lanes can not be moved to K
+static bool SinkBelow(VectorPair *ptr, VectorList *List, LLVMValueRef K, valmap_t needed, valmap_t sunk)
+{
+	LLVMValueRef X,U;
+	LLVMUseRef use;
+	LLVMBasicBlockRef BB = LLVMGetInstructionParent(K);
+	worklist_t work = worklist_create();
+	int k;
+	bool ok = true;
+	for(k=0;k<ptr->lanes;k++){
+		worklist_insert(work,ptr->pair[k]);
+	}
+	while(ok && !worklist_empty(work)){
+		X = worklist_pop(work);
+		for(use=LLVMGetFirstUse(X);ok && use!=NULL;use=LLVMGetNextUse(use)){
+			U = LLVMGetUser(use);
+			//uses in other blocks and PHIs are dominated by any place in BB
+			if(LLVMGetInstructionParent(U) != BB || LLVMIsAPHINode(U) || valmap_check(sunk,U) ||
+			   InPack(ptr,U) || ordinal(U) >= ordinal(K)){
+				continue;
+			}
+			//lanes of the list become vectors below this one anyway
+			if(List && valmap_check(List->visited,U)){
+				continue;
+			}
+			if(valmap_check(needed,U)){
+				ok = false;
+				break;
+			}
+			valmap_insert(sunk,U,(void*)1);
+			worklist_insert(work,U);
+			if(!MayWriteMemory(U) && !LLVMIsALoadInst(U)){
+				continue;
+			}
+			//lanes after U end up above it, accesses after it have to follow it down
+			for(k=0;k<ptr->lanes;k++){
+				if(ordinal(ptr->pair[k]) > ordinal(U) && MemoryConflict(U,ptr->pair[k])){
+					ok = false;
+				}
+			}
+			for(X=LLVMGetNextInstruction(U);ok && X!=K;X=LLVMGetNextInstruction(X)){
+				if(valmap_check(sunk,X) || InPack(ptr,X) || !MemoryConflict(U,X)){
+					continue;
+				}
+				if(valmap_check(needed,X)){
+					ok = false;
+				}else{
+					valmap_insert(sunk,X,(void*)1);
+					worklist_insert(work,X);
+				}
+			}
+		}
+	}
+	worklist_destroy(work);
+	return ok && MemoryMoveIsSafe(ptr,K,sunk);
+}
+
+//schedules the vector instruction of a pack. it has to come after the last
+//value of the block it reads (the operand vectors ops where they are set, the
+//operands of the lanes otherwise) and goes at the first lane when it can,
+//else after the last one. users of the lanes above that place are sunk below
+//it; the pack is rejected only when the pack itself depends on one of them.
+//List is set when the list is checked before anything is vectorized: users
+//that are lanes of the list do not count and nothing is moved.
+//the builder is left before the place of the vector instruction
+static bool IsTransformable(VectorPair* ptr, VectorList *List, LLVMValueRef *ops, int nops)
+{
+	LLVMValueRef K,L,X,op,next,last = NULL,first = NULL,final = NULL,top = NULL;
+	LLVMValueRef place[2];
+	LLVMBasicBlockRef BB = LLVMGetInstructionParent(ptr->pair[0]);
+	valmap_t needed, sunk;
+	char *name;
+	size_t len;
+	int i,k,p;
+	bool ok = false;
+
+	//PHIs become a vector PHI in their place, what comes around the back
+	//edge is only needed at the end of the trip
+	if(LLVMIsAPHINode(ptr->pair[0])){
+		ptr->at = NULL;
+		return true;
+	}
+	needed = poolMap();
+	for(k=0;k<ptr->lanes;k++){
+		L = ptr->pair[k];
+		for(i=0;i<LLVMGetNumOperands(L);i++){
+			op = (ops && i<nops && ops[i]) ? ops[i] : LLVMGetOperand(L,i);
+			if(!LLVMIsAInstruction(op) || LLVMGetInstructionParent(op) != BB){
+				continue;
+			}
+			if(InPack(ptr,op)){
+				poolMapRelease(needed);
+				return false;
+			}
+			valmap_insert(needed,op,(void*)1);
+			if(last == NULL || ordinal(op) > ordinal(last)){
+				last = op;
+			}
+		}
+		if(first == NULL || ordinal(L) < ordinal(first)){
+			first = L;
+		}
+		if(final == NULL || ordinal(L) > ordinal(final)){
+			final = L;
+		}
+	}
+	place[0] = first;
+	place[1] = LLVMGetNextInstruction(final);
+	sunk = poolMap();
+	for(p=0;p<2 && !ok;p++){
+		K = place[p];
+		if(last && ordinal(K) <= ordinal(last)){
+			K = LLVMGetNextInstruction(last);
+		}
+		//nothing but PHIs may go before a PHI
+		while(LLVMIsAPHINode(K)){
+			K = LLVMGetNextInstruction(K);
+		}
+		valmap_clear(sunk);
+		ok = SinkBelow(ptr,List,K,needed,sunk);
+	}
+	if(ok && !List){
+		//sink in block order, the vector instruction goes above the first of them
+		for(X=first;X!=NULL && X!=K && X!=top;X=next){
+			next = LLVMGetNextInstruction(X);
+			if(!valmap_check(sunk,X)){
+				continue;
+			}
+			name = strdup(LLVMGetValueName2(X,&len));
+			LLVMInstructionRemoveFromParent(X);
+			LLVMPositionBuilderBefore(Ctx->Builder,K);
+			LLVMInsertIntoBuilderWithName(Ctx->Builder,X,name);
+			free(name);
+			if(top == NULL){
+				top = X;
+			}
+		}
+		if(top){
+			orderInvalidate(LLVMGetInstructionParent(K));
+			K = top;
+		}
+	}
+	if(ok){
+		LLVMPositionBuilderBefore(Ctx->Builder,K);
+		ptr->at = K;
+	}
+	poolMapRelease(needed);
+	poolMapRelease(sunk);
+	return ok;
+}
+
+//the vector form of math call I over n lanes, NULL when the module already
+//has a different function by that name
+static LLVMValueRef BuildMathCall(LLVMValueRef I, LLVMValueRef *ops, int n)
+{
+	const MathEntry *M = MathLookup(I,n);
+	LLVMModuleRef Mod = LLVMGetGlobalParent(LLVMGetBasicBlockParent(LLVMGetInstructionParent(I)));
+	LLVMTypeRef V = LLVMVectorType(LLVMTypeOf(I),n), params[MAX_MATH_ARGS], FT;
+	LLVMValueRef F;
+	int i, nargs = LLVMGetNumArgOperands(I);
+	if(M == NULL){
+		return NULL;
+	}
+	if(M->lanes == 0){
+		unsigned id = LLVMLookupIntrinsicID(M->vector,strlen(M->vector));
+		if(id == 0){
+			return NULL;
+		}
+		F = LLVMGetIntrinsicDeclaration(Mod,id,&V,1);
+	}else{
+		for(i=0;i<nargs;i++){
+			params[i] = V;
+		}
+		FT = LLVMFunctionType(V,params,nargs,0);
+		if((F = LLVMGetNamedFunction(Mod,M->vector)) == NULL){
+			F = LLVMAddFunction(Mod,M->vector,FT);
+			LLVMAddAttributeAtIndex(F,LLVMAttributeFunctionIndex,
+					LLVMCreateEnumAttribute(LLVMGetModuleContext(Mod),MathReadNone,0));
+		}else if(LLVMGlobalGetValueType(F) != FT){
+			return NULL;
+		}
+	}
+	return LLVMBuildCall2(Ctx->Builder,LLVMGlobalGetValueType(F),F,ops,nargs,"");
+}
+
+//a wide load of the records V stands for still holds them at At when
+//nothing in between may write them
+static bool SpanIntact(LLVMValueRef V, LLVMValueRef At)
+{
+	LLVMValueRef X;
+	if(LLVMGetInstructionParent(V) != LLVMGetInstructionParent(At) || ordinal(V) >= ordinal(At)){
+		return false;
+	}
+	for(X=LLVMGetNextInstruction(V);X!=At;X=LLVMGetNextInstruction(X)){
+		if(MemoryConflict(X,V)){
+			return false;
+		}
+	}
+	return true;
+}
+
+//the strided access of pack ptr as one contiguous access over the records:
+//a load of the records its interleave group reads, shared by the packs of
+//the group, and a shuffle that picks the lanes out of it; a store spreads
+//the lanes out with a shuffle and stores them with a mask that keeps the
+//other fields as they are. spans maps a group to its load
+static LLVMValueRef BuildStrided(VectorList *List, VectorPair *ptr, LLVMValueRef *ops, valmap_t spans)
+{
+	LLVMValueRef I = ptr->pair[0], P = LLVMGetOperand(I,PointerOperand(I)), V = NULL, F;
+	LLVMValueRef mask[MAX_LANES*MAX_STRIDE], keep[MAX_LANES*MAX_STRIDE], args[4], idx;
+	LLVMTypeRef T = LLVMGetElementType(LLVMTypeOf(P)), types[2];
+	LLVMModuleRef Mod = LLVMGetGlobalParent(LLVMGetBasicBlockParent(LLVMGetInstructionParent(I)));
+	VectorPair *first = NULL;
+	long s = PackStride(ptr), lo = 0, hi = (ptr->lanes-1)*s, j;
+	unsigned align = LLVMGetAlignment(I), id;
+	int k;
+	if(LLVMIsALoadInst(I)){
+		first = GroupSpan(List,ptr,&lo,&hi);
+		if(valmap_check(spans,first->pair[0])){
+			V = (LLVMValueRef)valmap_find(spans,first->pair[0]);
+			if(!SpanIntact(V,ptr->at)){
+				V = NULL;
+			}
+		}
+	}
+	if(V == NULL){
+		if(lo != 0){
+			//lane 0 is lo elements into the records, as aligned as that allows
+			idx = LLVMConstInt(LLVMInt64Type(),(unsigned long long)lo,1);
+			P = LLVMBuildInBoundsGEP2(Ctx->Builder,T,P,&idx,1,"");
+			j = -lo*(long)LayoutQuery(LLVMABISizeOfType,T);
+			if((unsigned long)(j & -j) < align){
+				align = (unsigned)(j & -j);
+			}
+		}
+		P = LLVMBuildBitCast(Ctx->Builder,P,LLVMPointerType(LLVMVectorType(T,hi-lo+1),
+				LLVMGetPointerAddressSpace(LLVMTypeOf(P))),"");
+	}
+	if(LLVMIsALoadInst(I)){
+		if(V == NULL){
+			V = LLVMBuildLoad2(Ctx->Builder,LLVMVectorType(T,hi-lo+1),P,"v.span");
+			LLVMSetAlignment(V,align);
+			valmap_insert(spans,first->pair[0],(void*)V);
+		}
+		for(k=0;k<ptr->lanes;k++){
+			mask[k] = LLVMConstInt(LLVMInt32Type(),(unsigned long long)(k*s-lo),0);
+		}
+		return LLVMBuildShuffleVector(Ctx->Builder,V,LLVMGetUndef(LLVMTypeOf(V)),LLVMConstVector(mask,ptr->lanes),"v.lanes");
+	}
+	for(j=0;j<=hi;j++){
+		mask[j] = j%s == 0 ? LLVMConstInt(LLVMInt32Type(),(unsigned long long)(j/s),0) : LLVMGetUndef(LLVMInt32Type());
+		keep[j] = LLVMConstInt(LLVMInt1Type(),j%s == 0,0);
+	}
+	args[0] = LLVMBuildShuffleVector(Ctx->Builder,ops[0],LLVMGetUndef(LLVMTypeOf(ops[0])),LLVMConstVector(mask,hi+1),"v.spread");
+	args[1] = P;
+	args[2] = LLVMConstInt(LLVMInt32Type(),align,0);
+	args[3] = LLVMConstVector(keep,hi+1);
+	id = LLVMLookupIntrinsicID("llvm.masked.store",strlen("llvm.masked.store"));
+	types[0] = LLVMTypeOf(args[0]);
+	types[1] = LLVMTypeOf(P);
+	F = LLVMGetIntrinsicDeclaration(Mod,id,types,2);
+	return LLVMBuildCall2(Ctx->Builder,LLVMGlobalGetValueType(F),F,args,4,"");
+}
+
+static LLVMValueRef Build(LLVMValueRef I,LLVMOpcode opcode,int size, LLVMValueRef ops[size],int lanes)
+{
+	LLVMValueRef newinsn = NULL;
+
+	switch(opcode){
+		case LLVMAdd:
+				newinsn = LLVMBuildAdd (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMFAdd: 	
+				newinsn = LLVMBuildFAdd (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMSub:	
+				newinsn = LLVMBuildSub (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMFSub: 	
+				newinsn = LLVMBuildFSub (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMCall:
+				newinsn = BuildMathCall(I,ops,lanes);
+				break;
+		case LLVMMul: 	
+				newinsn = LLVMBuildMul (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMFMul: 	
+				newinsn = LLVMBuildFMul (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMUDiv: 	
+				newinsn = LLVMBuildUDiv (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMSDiv: 	
+				newinsn = LLVMBuildSDiv (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMFDiv: 
+				newinsn = LLVMBuildFDiv (Ctx->Builder, ops[0], ops[1], "");
+				break;			
+		case LLVMURem: 	
+				newinsn = LLVMBuildURem (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMSRem: 	
+				newinsn = LLVMBuildSRem (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMFRem: 	
+				newinsn = LLVMBuildFRem (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMShl:	
+				newinsn = LLVMBuildShl (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMLShr: 	
+				newinsn = LLVMBuildLShr (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMAShr: 	
+				newinsn = LLVMBuildAShr (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMAnd: 	
+				newinsn = LLVMBuildAnd (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMOr: 	
+				newinsn = LLVMBuildOr (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMXor: 	
+				newinsn = LLVMBuildXor (Ctx->Builder, ops[0], ops[1], "");
+				break;
+		case LLVMICmp:
+				newinsn = LLVMBuildICmp (Ctx->Builder, LLVMGetICmpPredicate(I), ops[0], ops[1], "");
+				break;
+		case LLVMFCmp:
+				newinsn = LLVMBuildFCmp (Ctx->Builder, LLVMGetFCmpPredicate(I), ops[0], ops[1], "");
+				break;
+		case LLVMSelect:
+				//one mask lane per lane, or one i1 for all of them
+				newinsn = LLVMBuildSelect (Ctx->Builder, ops[0], ops[1], ops[2], "");
+				break;
+		case LLVMAlloca: 	
+				//the lanes become the elements of one vector alloca
+				newinsn = LLVMBuildAlloca (Ctx->Builder, LLVMVectorType(LLVMGetElementType(LLVMTypeOf(I)),lanes), "");
+				break;
+		case LLVMLoad:
+				newinsn = LLVMBuildLoad2 (Ctx->Builder, LLVMVectorType(LLVMTypeOf(I),lanes), ops[0],"");
+				break;
+		case LLVMStore: 	
+				newinsn = LLVMBuildStore (Ctx->Builder, ops[0], ops[1]);
+				break;
+		case LLVMTrunc:
+		case LLVMZExt: 	
+		case LLVMSExt: 	
+		case LLVMFPToUI: 	
+		case LLVMFPToSI: 	
+		case LLVMUIToFP: 	
+		case LLVMSIToFP: 	
+		case LLVMFPTrunc: 	
+		case LLVMFPExt:
+		case LLVMPtrToInt: 	
+		case LLVMIntToPtr:	
+		case LLVMBitCast:
+				newinsn = LLVMBuildCast (Ctx->Builder, opcode, ops[0], LLVMVectorType(LLVMTypeOf(I),lanes), "");
+				break;
+//		case LLVMGetElementPtr:
+		default:
+			fprintf(Ctx->log,"Vectorization not supported for this instruction\n");
+			break;
+	}
+	return newinsn;
+
+}
+
+//the vector op2vec holds for lanes, if lanes[k] sits in element k for every k
+static LLVMValueRef findVec(valmap_t op2vec, valmap_t op2lane, LLVMValueRef *lanes, int n)
+{
+	LLVMValueRef vec;
+	int k;
+	if(!valmap_check(op2vec,lanes[0])){
+		return NULL;
+	}
+	vec = (LLVMValueRef)valmap_find(op2vec,lanes[0]);
+	for(k=0;k<n;k++){
+		if((LLVMValueRef)valmap_find(op2vec,lanes[k]) != vec || (long)valmap_find(op2lane,lanes[k]) != k+1){
+			return NULL;
+		}
+	}
+	return vec;
+}
+
+//position the builder right after I, past any PHIs
+static void PositionAfter(LLVMValueRef I)
+{
+	LLVMValueRef N = LLVMGetNextInstruction(I);
+	while(N && LLVMIsAPHINode(N)){
+		N = LLVMGetNextInstruction(N);
+	}
+	if(N){
+		LLVMPositionBuilderBefore(Ctx->Builder,N);
+	}else{
+		LLVMPositionBuilderAtEnd(Ctx->Builder,LLVMGetInstructionParent(I));
+	}
+}
+
+//builds an operand out of vectors that already hold its lanes: one of them
+//as it is or a shufflevector of two. the builder is after last, or before
+//at when that is set; NULL when the lanes have to be gathered
+static LLVMValueRef ReuseVector(valmap_t op2vec, valmap_t op2lane, LLVMValueRef *lanes, int n,
+		LLVMValueRef last, LLVMValueRef at)
+{
+	LLVMValueRef src[2], V, M[MAX_LANES];
+	int mask[MAX_LANES];
+	LLVMBasicBlockRef BB = LLVMGetInstructionParent(at ? at : last);
+	int k, nsrc, width;
+	nsrc = FindLaneSources(NULL,op2vec,op2lane,lanes,n,(void**)src,&width,mask);
+	if(nsrc == 0){
+		return NULL;
+	}
+	for(k=0;k<nsrc;k++){
+		//vectors of other blocks are only reached through lanes they dominate
+		if(!LLVMIsAInstruction(src[k]) || LLVMGetInstructionParent(src[k]) != BB){
+			continue;
+		}
+		if(at){
+			if(src[k] == at || !dom(src[k],at)){
+				return NULL;
+			}
+		}else if(dom(last,src[k])){
+			last = src[k];
+		}
+	}
+	if(IsIdentityReuse(nsrc,width,mask,n)){
+		return src[0];
+	}
+	if(!at){
+		PositionAfter(last);
+	}
+	for(k=0;k<n;k++){
+		M[k] = LLVMConstInt(LLVMInt32Type(),(unsigned int)mask[k],0);
+	}
+	V = LLVMBuildShuffleVector(Ctx->Builder,src[0],nsrc == 2 ? src[1] : LLVMGetUndef(LLVMTypeOf(src[0])),
+			LLVMConstVector(M,n),"v.reuse");
+	return V;
+}
+
+//I has no uses and no side effects
+static bool IsDead(LLVMValueRef I)
+{
+	if(LLVMGetFirstUse(I) != NULL){
+		return false;
+	}
+	switch(LLVMGetInstructionOpcode(I)){
+		case LLVMStore:
+		case LLVMCall:
+		case LLVMInvoke:
+		case LLVMFence:
+		case LLVMAtomicCmpXchg:
+		case LLVMAtomicRMW:
+		case LLVMVAArg:
+		case LLVMPHI:
+		case LLVMLandingPad:
+			return false;
+		case LLVMLoad:
+			return !LLVMGetVolatile(I);
+		default:
+			return !LLVMIsATerminatorInst(I);
+	}
+}
+
+//erase the dead instructions on the worklist and whatever dies with them
+static void RemoveDead(worklist_t dead)
+{
+	LLVMValueRef I,op;
+	int i;
+	valmap_t gone = valmap_create();
+	while(!worklist_empty(dead)){
+		I = worklist_pop(dead);
+		if(valmap_check(gone,I) || !IsDead(I)){
+			continue;
+		}
+		for(i=0;i<LLVMGetNumOperands(I);i++){
+			op = LLVMGetOperand(I,i);
+			if(LLVMIsAInstruction(op) && !valmap_check(gone,op)){
+				worklist_insert(dead,op);
+			}
+		}
+		valmap_insert(gone,I,(void*)1);
+		eraseInst(I);
+	}
+	valmap_destroy(gone);
+}
+
+//an integer vector as n lanes of the given width, extended or truncated
+static LLVMValueRef ResizeVector(LLVMValueRef V, int bits, int n)
+{
+	LLVMTypeRef T = LLVMVectorType(LLVMIntType(bits),n);
+	int w = LLVMGetIntTypeWidth(LLVMGetElementType(LLVMTypeOf(V)));
+	if(w == bits){
+		return V;
+	}
+	if(LLVMIsAConstant(V)){
+		return w < bits ? LLVMConstZExt(V,T) : LLVMConstTrunc(V,T);
+	}
+	return w < bits ? LLVMBuildZExt(Ctx->Builder,V,T,"") : LLVMBuildTrunc(Ctx->Builder,V,T,"");
+}
+
+//the PHIs of a pack become one vector PHI at the top of their loop, it starts
+//from the lanes gathered once in the preheader; the back edge is added by
+//ClosePHI once the vector of the next trip exists
+static LLVMValueRef BuildVectorPHI(VectorPair *ptr)
+{
+	LLVMValueRef I = ptr->pair[0], lanes[MAX_LANES], init, V;
+	LLVMBasicBlockRef H = LLVMGetInstructionParent(I), P = LoopPreheader(H);
+	int i = LLVMGetIncomingBlock(I,0) == P ? 0 : 1, k;
+	for(k=0;k<ptr->lanes;k++){
+		lanes[k] = LLVMGetIncomingValue(ptr->pair[k],i);
+	}
+	LLVMPositionBuilderBefore(Ctx->Builder,LLVMGetBasicBlockTerminator(P));
+	init = assembleVec(lanes,ptr->lanes);
+	LLVMPositionBuilderBefore(Ctx->Builder,LLVMGetFirstInstruction(H));
+	V = LLVMBuildPhi(Ctx->Builder,LLVMVectorType(LLVMTypeOf(I),ptr->lanes),"v.phi");
+	LLVMAddIncoming(V,&init,&P,1);
+	return V;
+}
+
+//the back edge of the vector PHI V of ptr: the pack that computes the next
+//trip when there is one, the lanes gathered at the end of the trip otherwise
+static void ClosePHI(VectorPair *ptr, LLVMValueRef V, valmap_t op2vec, valmap_t op2lane)
+{
+	LLVMValueRef I = ptr->pair[0], lanes[MAX_LANES], next;
+	LLVMBasicBlockRef H = LLVMGetInstructionParent(I);
+	int i = LLVMGetIncomingBlock(I,0) == H ? 0 : 1, k;
+	for(k=0;k<ptr->lanes;k++){
+		lanes[k] = LLVMGetIncomingValue(ptr->pair[k],i);
+	}
+	next = findVec(op2vec,op2lane,lanes,ptr->lanes);
+	if(next == NULL){
+		LLVMPositionBuilderBefore(Ctx->Builder,LLVMGetBasicBlockTerminator(H));
+		next = ReuseVector(op2vec,op2lane,lanes,ptr->lanes,NULL,LLVMGetBasicBlockTerminator(H));
+		if(next == NULL){
+			next = assembleVec(lanes,ptr->lanes);
+		}
+	}
+	LLVMAddIncoming(V,&next,&H,1);
+}
+
+//lane k of V for the uses of L past the exit of its single block loop: at the
+//top of an exit only the loop reaches, so it is not extracted on every trip.
+//a PHI there merges that one edge and is replaced by the extract. the caller
+//holds ModuleLock
+static void ExtractAtExits(LLVMValueRef L, LLVMValueRef V, int k)
+{
+	LLVMBasicBlockRef H = LLVMGetInstructionParent(L), E = NULL, B;
+	LLVMValueRef T = LLVMGetBasicBlockTerminator(H), ev = NULL, X, at;
+	LLVMUseRef use;
+	worklist_t users;
+	int s, i;
+	if(LoopPreheader(H) == NULL || LLVMGetNumSuccessors(T) != 2){
+		return;
+	}
+	for(s=0;s<2;s++){
+		if(LLVMGetSuccessor(T,1-s) == H && LLVMGetSuccessor(T,s) != H){
+			E = LLVMGetSuccessor(T,s);
+		}
+	}
+	if(E == NULL){
+		return;
+	}
+	//the exit is only entered from the loop
+	for(use=LLVMGetFirstUse(LLVMBasicBlockAsValue(E));use!=NULL && LLVMGetUser(use)==T;use=LLVMGetNextUse(use));
+	if(use != NULL){
+		return;
+	}
+	users = worklist_create();
+	for(use=LLVMGetFirstUse(L);use!=NULL;use=LLVMGetNextUse(use)){
+		if(LLVMGetInstructionParent(LLVMGetUser(use)) != H){
+			worklist_insert(users,LLVMGetUser(use));
+		}
+	}
+	while(!worklist_empty(users)){
+		X = worklist_pop(users);
+		B = LLVMGetInstructionParent(X);
+		if(LLVMIsAPHINode(X) ? B != E || LLVMCountIncoming(X) != 1 :
+		   !LLVMDominates(LLVMGetBasicBlockParent(H),E,B)){
+			continue;
+		}
+		if(ev == NULL){
+			for(at=LLVMGetFirstInstruction(E);LLVMIsAPHINode(at);at=LLVMGetNextInstruction(at));
+			LLVMPositionBuilderBefore(Ctx->Builder,at);
+			ev = LLVMBuildExtractElement(Ctx->Builder,V,LLVMConstInt(LLVMInt32Type(),(unsigned int)k,0),"");
+		}
+		if(LLVMIsAPHINode(X)){
+			LLVMReplaceAllUsesWith(X,ev);
+			LLVMInstructionEraseFromParent(X);
+			continue;
+		}
+		for(i=0;i<LLVMGetNumOperands(X);i++){
+			if(LLVMGetOperand(X,i) == L){
+				LLVMSetOperand(X,i,ev);
+			}
+		}
+	}
+	worklist_destroy(users);
+}
+
+//fusion stage: an fadd or fsub pack built from an fmul pack that only it
+//reads becomes one llvm.fmuladd, which the backend emits as a vector fma
+static void FuseMulAdd(VectorList *List, valmap_t op2vec)
+{
+	VectorPair *ptr, *src;
+	LLVMValueRef A, M, F, args[3];
+	LLVMTypeRef T;
+	LLVMModuleRef Mod;
+	int i, k;
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		if(ptr->insertAt0 != 1 || (i = FusedOperand(List,ptr)) < 0){
+			continue;
+		}
+		src = (VectorPair*)valmap_find(List->visited,PackOperand(ptr,0,i));
+		A = (LLVMValueRef)valmap_find(op2vec,ptr->pair[0]);
+		M = (LLVMValueRef)valmap_find(op2vec,src->pair[0]);
+		//either pack may have stayed scalar or folded into a constant
+		if(src->insertAt0 != 1 || !LLVMIsAInstruction(A) || !LLVMIsAInstruction(M) ||
+		   LLVMGetInstructionOpcode(A) != LLVMGetInstructionOpcode(ptr->pair[0]) || LLVMGetInstructionOpcode(M) != LLVMFMul ||
+		   LLVMGetOperand(A,i) != M || LLVMGetNextUse(LLVMGetFirstUse(M)) != NULL){
+			continue;
+		}
+		LLVMPositionBuilderBefore(Ctx->Builder,A);
+		args[0] = LLVMGetOperand(M,0);
+		args[1] = LLVMGetOperand(M,1);
+		args[2] = LLVMGetOperand(A,1-i);
+		//a*b - c and c - a*b
+		if(LLVMGetInstructionOpcode(A) == LLVMFSub){
+			if(i == 0){
+				args[2] = LLVMBuildFNeg(Ctx->Builder,args[2],"");
+			}else{
+				args[0] = LLVMBuildFNeg(Ctx->Builder,args[0],"");
+			}
+		}
+		T = LLVMTypeOf(A);
+		Mod = LLVMGetGlobalParent(LLVMGetBasicBlockParent(LLVMGetInstructionParent(A)));
+		F = LLVMGetIntrinsicDeclaration(Mod,LLVMLookupIntrinsicID("llvm.fmuladd",strlen("llvm.fmuladd")),&T,1);
+		F = LLVMBuildCall2(Ctx->Builder,LLVMGlobalGetValueType(F),F,args,3,"v.fma");
+		LLVMReplaceAllUsesWith(A,F);
+		eraseInst(A);
+		eraseInst(M);
+		for(k=0;k<ptr->lanes;k++){
+			valmap_insert(op2vec,ptr->pair[k],(void*)F);
+			valmap_remove(op2vec,src->pair[k]);
+		}
+		//the fmul lanes die with the fadd lanes, nothing is extracted from them
+		src->insertAt0 = 0;
+		Ctx->fused++;
+	}
+}
+
+//whether every user of L is a lane of a pack that is vectorized as well,
+//those lanes are erased with L so it needs no extract
+static bool UsedOnlyByPacks(VectorList *List, LLVMValueRef L)
+{
+	LLVMUseRef U;
+	VectorPair *user;
+	for(U=LLVMGetFirstUse(L);U!=NULL;U=LLVMGetNextUse(U)){
+		if(!valmap_check(List->visited,LLVMGetUser(U))){
+			return false;
+		}
+		user = (VectorPair*)valmap_find(List->visited,LLVMGetUser(U));
+		if(user->insertAt0 != 1){
+			return false;
+		}
+	}
+	return true;
+}
+
+static void Vectorize(VectorList* List)
+{
+	VectorPair *ptr = NULL;
+	int i=0, k=0, flag =0, allInst, ptrOp, memKind;
+	LLVMValueRef I,L,last,newinsn,ev;
+	LLVMValueRef lanes[MAX_LANES];
+	worklist_t dead;
+	//create a valmap that maps original values (key) to vector values (data)
+	//and one that remembers which element of that vector holds the value
+	valmap_t op2vec, op2lane, spans;
+	op2vec = valmap_create();
+	op2lane = valmap_create();
+	spans = poolMap();
+	dead = worklist_create();
+	//commutative lanes take the operand order the pack was formed with
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		for(k=0;k<ptr->lanes;k++){
+			if(ptr->swapped>>k & 1){
+				L = LLVMGetOperand(ptr->pair[k],0);
+				LLVMSetOperand(ptr->pair[k],0,LLVMGetOperand(ptr->pair[k],1));
+				LLVMSetOperand(ptr->pair[k],1,L);
+			}
+		}
+		ptr->swapped = 0;
+	}
+	//for each pack in L in dominance order:
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		I=ptr->pair[0];
+		//using gcc extension: variable length array of vectors
+		LLVMValueRef ops[LLVMGetNumOperands(I)];
+		if(LLVMIsAPHINode(I)){
+			newinsn = BuildVectorPHI(ptr);
+			for(k=0;k<ptr->lanes;k++){
+				valmap_insert(op2vec,ptr->pair[k],(void*)newinsn);
+				valmap_insert(op2lane,ptr->pair[k],(void*)(long)(k+1));
+			}
+			continue;
+		}
+		//loads and stores need the vector alloca their lanes point into,
+		//or consecutive or strided addresses that become one wide access
+		ptrOp = PointerOperand(I);
+		memKind = ptrOp >= 0 ? MemoryPackKind(ptr->pair,ptr->lanes) : MEM_NONE;
+		for(i=0;i<LLVMGetNumOperands(I);i++){
+			allInst = 1;
+			ops[i] = NULL;
+			if(i == ptrOp && (memKind == MEM_CONSECUTIVE || memKind == MEM_STRIDED)){
+				//address of lane 0 is cast at the insertion point
+				continue;
+			}
+			if(i == CalleeOperand(I)){
+				continue;
+			}
+			for(k=0;k<ptr->lanes;k++){
+				lanes[k] = LLVMGetOperand(ptr->pair[k],i);
+				if(!LLVMIsAInstruction(lanes[k])){
+					allInst = 0;
+				}
+			}
+			if(SharedCondition(ptr,i)){
+				ops[i] = lanes[0];
+				continue;
+			}
+			if(!allInst){
+				//constants and arguments are packed at the insertion point
+				continue;
+			}
+			ops[i] = findVec(op2vec,op2lane,lanes,ptr->lanes);
+			if(i == ptrOp){
+				//corner case: pointer operands that are not vectorized
+				if(ops[i] == NULL || LLVMGetTypeKind(LLVMTypeOf(ops[i])) != LLVMPointerTypeKind){
+					flag = 1;
+					break;
+				}
+			}
+			//if vmap[Op(lanes,i)] is not found:
+			if(ops[i] == NULL){
+				//ops[i] = packVector(op(lanes,i)) right after the last of them
+				last = lanes[0];
+				for(k=1;k<ptr->lanes;k++){
+					if(dom(last,lanes[k])){
+						last = lanes[k];
+					}
+				}
+				PositionAfter(last);
+				ops[i] = ReuseVector(op2vec,op2lane,lanes,ptr->lanes,last,NULL);
+				if(ops[i] == NULL){
+					PositionAfter(last);
+					ops[i] = assembleVec(lanes,ptr->lanes);
+					regRecord(ops[i],lanes,ptr->lanes);
+				}
+				//vmap[op(lane k,i)] = ops[i]
+				for(k=0;k<ptr->lanes;k++){
+					valmap_insert(op2vec,lanes[k],(void*)(ops[i]));
+					valmap_insert(op2lane,lanes[k],(void*)(long)(k+1));
+				}
+			}
+		}
+		if(flag == 1){
+			ptr->insertAt0 = 0;
+			flag = 0;
+			continue;	
+		}
+		if(IsTransformable(ptr,NULL,ops,LLVMGetNumOperands(I)) == false){
+			//the operand vectors stay behind and are cleaned up as dead code
+			ptr->insertAt0 = 0;
+			continue;
+		}
+		//pack the operands that are not instructions right here
+		for(i=0;i<LLVMGetNumOperands(I);i++){
+			if(i == ptrOp && memKind == MEM_CONSECUTIVE){
+				L = LLVMGetOperand(ptr->pair[0],i);
+				ops[i] = LLVMBuildBitCast(Ctx->Builder,L,LLVMPointerType(LLVMVectorType(LLVMGetElementType(LLVMTypeOf(L)),ptr->lanes),
+						LLVMGetPointerAddressSpace(LLVMTypeOf(L))),"");
+				continue;
+			}
+			if(i == ptrOp && memKind == MEM_STRIDED){
+				ops[i] = LLVMGetOperand(ptr->pair[0],i);
+				continue;
+			}
+			if(ops[i] == NULL && !(LLVMIsAAllocaInst(I)) && i != CalleeOperand(I)){
+				for(k=0;k<ptr->lanes;k++){
+					lanes[k] = LLVMGetOperand(ptr->pair[k],i);
+				}
+				ops[i] = ReuseVector(op2vec,op2lane,lanes,ptr->lanes,NULL,ptr->at);
+				if(ops[i] == NULL){
+					ops[i] = assembleVec(lanes,ptr->lanes);
+					regRecord(ops[i],lanes,ptr->lanes);
+				}
+			}
+		}
+		//a narrowed pack reads its operands at its own width
+		if(ptr->bits && !LLVMIsAZExtInst(I)){
+			for(i=0;i<LLVMGetNumOperands(I);i++){
+				ops[i] = ResizeVector(ops[i],ptr->bits,ptr->lanes);
+			}
+		}
+		//implement the generic vector insn builder
+		if(ptr->bits && (LLVMIsAZExtInst(I) || LLVMIsATruncInst(I))){
+			newinsn = ResizeVector(ops[0],LLVMIsAZExtInst(I) ? ptr->bits : (int)LLVMGetIntTypeWidth(LLVMTypeOf(I)),ptr->lanes);
+		}else if(memKind == MEM_STRIDED){
+			newinsn = BuildStrided(List,ptr,ops,spans);
+		}else{
+			newinsn = Build(I,LLVMGetInstructionOpcode(I),LLVMGetNumOperands(I),ops,ptr->lanes);
+		}
+		if(newinsn == NULL){
+			ptr->insertAt0 = 0;
+			continue;
+		}
+		//alternating lanes: the other operation too, lane k taken from the one it does
+		if((L = AltLane(ptr)) != NULL){
+			LLVMValueRef mask[MAX_LANES];
+			ev = Build(L,LLVMGetInstructionOpcode(L),LLVMGetNumOperands(L),ops,ptr->lanes);
+			for(k=0;k<ptr->lanes;k++){
+				mask[k] = LLVMConstInt(LLVMInt32Type(),(unsigned int)(LLVMGetInstructionOpcode(ptr->pair[k]) ==
+						LLVMGetInstructionOpcode(I) ? k : ptr->lanes+k),0);
+			}
+			newinsn = LLVMBuildShuffleVector(Ctx->Builder,newinsn,ev,LLVMConstVector(mask,ptr->lanes),"v.alt");
+		}
+		//a wide access is only known to be as aligned as its first lane
+		if(memKind == MEM_CONSECUTIVE){
+			LLVMSetAlignment(newinsn,LLVMGetAlignment(I));
+		}
+		for(k=0;k<ptr->lanes;k++){
+			valmap_insert(op2vec,ptr->pair[k],(void*)newinsn);
+			valmap_insert(op2lane,ptr->pair[k],(void*)(long)(k+1));
+		}
+	}
+	FuseMulAdd(List,op2vec);
+	//vector PHIs take the next trip from the vectors built above
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		if(LLVMIsAPHINode(ptr->pair[0])){
+			ClosePHI(ptr,(LLVMValueRef)valmap_find(op2vec,ptr->pair[0]),op2vec,op2lane);
+		}
+	}
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		LLVMValueRef indices[2];
+		if(ptr->insertAt0 != 1)
+			continue;
+		for(k=0;k<ptr->lanes;k++){
+			L = ptr->pair[k];
+			if(!LLVMIsAAllocaInst(L)){
+				ExtractAtExits(L,(LLVMValueRef)valmap_find(op2vec,L),k);
+			}
+			//if lane has uses:
+			if(LLVMGetFirstUse(L) == NULL)
+				continue;
+			//nothing outside the packs reads L, its users are erased with it
+			if(UsedOnlyByPacks(List,L)){
+				LLVMReplaceAllUsesWith(L,LLVMGetUndef(LLVMTypeOf(L)));
+				continue;
+			}
+			// Reposition builder
+			PositionAfter((LLVMValueRef)valmap_find(op2vec,L));
+			//ev = BuildExtractElement(vmap[L],k) // index k
+			if(LLVMIsAAllocaInst(L)){
+				//address of element k of the vector alloca
+				indices[0] = LLVMConstInt(LLVMInt32Type(), (unsigned int)0, 0) ;
+				indices[1] = LLVMConstInt(LLVMInt32Type(), (unsigned int)k, 0) ;
+				ev = LLVMBuildInBoundsGEP2(Ctx->Builder,LLVMGetAllocatedType((LLVMValueRef)valmap_find(op2vec,L)),
+				                          (LLVMValueRef)valmap_find(op2vec,L),indices,(unsigned int)2,"");
+			}else{
+				ev = LLVMBuildExtractElement (Ctx->Builder, (LLVMValueRef)valmap_find(op2vec,L), LLVMConstInt(LLVMInt32Type(), (unsigned int)k, 0), "");
+				//a narrowed lane is widened back, the region only starts at
+				//zexts so its values are unsigned and only the low bits count
+				if(LLVMTypeOf(ev) != LLVMTypeOf(L)){
+					ev = LLVMBuildZExt(Ctx->Builder,ev,LLVMTypeOf(L),"");
+				}
+			}
+			LLVMReplaceAllUsesWith(L,ev);
+			worklist_insert(dead,ev);
+		}
+	}
+	//the scalar lanes are replaced now, erase them
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		if(ptr->insertAt0 != 1)
+			continue;
+		for(k=0;k<ptr->lanes;k++){
+			L = ptr->pair[k];
+			for(i=0;i<LLVMGetNumOperands(L);i++){
+				if(LLVMIsAInstruction(LLVMGetOperand(L,i))){
+					worklist_insert(dead,LLVMGetOperand(L,i));
+				}
+			}
+			eraseInst(L);
+		}
+	}
+	valmap_destroy(op2vec);
+	valmap_destroy(op2lane);
+	poolMapRelease(spans);
+	//Remove any dead extractelements we inserted
+	RemoveDead(dead);
+	worklist_destroy(dead);
+}
+
+
+static void printList(VectorList *List)
+{
+	VectorPair* ptr = NULL;
+	int k;
+	char *str;
+	fprintf(Ctx->log,"VectorList instruction pairs:\n");
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next)
+	{
+		for(k=0;k<ptr->lanes;k++){
+			str = LLVMPrintValueToString(ptr->pair[k]);
+			fprintf(Ctx->log,"%s\n",str);
+			LLVMDisposeMessage(str);
+		}
+	}
+}
+
+//grow the best seed pair (insts[c],insts[a]) of a bucket into a wider pack
+//members of the bucket around the seed that are independent of it are the
+//candidate lanes, in block order or, for loads and stores, in address order
+//so that consecutive accesses line up; windows of the widest power of two
+//the target holds that cover the seed are tried first
+static VectorList *widenSeed(SeedBucket *bucket, int a, int c, VectorList *best)
+{
+	LLVMValueRef cand[3*SEED_WINDOW+1];//c is at most SEED_WINDOW before a
+	long offset[3*SEED_WINDOW+1];
+	VectorList *wide;
+	MemAddr seedAddr,addr;
+	LLVMValueRef I = bucket->insts[a], J = bucket->insts[c], T;
+	int n = 0, w, p, k, j, start, lo, hi, seedLo = 0, seedHi = 0;
+	int max = MaxLanes(I);
+	int ptrOp = PointerOperand(I);
+	long to;
+
+	if(max <= 2){
+		return best;
+	}
+	if(ptrOp >= 0){
+		LLVMValueRef seed[2] = {J,I};
+		//lanes through allocas of their own stay in block order
+		if(MemoryPackKind(seed,2) != MEM_CONSECUTIVE){
+			ptrOp = -1;
+		}else{
+			DecomposeAddress(LLVMGetOperand(J,ptrOp),&seedAddr);
+		}
+	}
+	lo = c>SEED_WINDOW ? c-SEED_WINDOW : 0;
+	hi = a+SEED_WINDOW<bucket->size ? a+SEED_WINDOW : bucket->size-1;
+	for(p=lo;p<=hi;p++){
+		T = bucket->insts[p];
+		if(p != a && p != c){
+			if(!ShouldVectorize(T,I) || !ShouldVectorize(I,T) || !ShouldVectorize(T,J) || !ShouldVectorize(J,T)){
+				continue;
+			}
+		}
+		offset[n] = 0;
+		if(ptrOp >= 0){
+			DecomposeAddress(LLVMGetOperand(T,ptrOp),&addr);
+			if(addr.base != seedAddr.base || addr.index != seedAddr.index || addr.scale != seedAddr.scale){
+				continue;
+			}
+			offset[n] = addr.offset;
+		}
+		//insertion sort on offset keeps block order for everything else
+		for(k=n;k>0 && offset[k-1]>offset[n];k--);
+		to = offset[n];
+		memmove(cand+k+1,cand+k,(n-k)*sizeof(LLVMValueRef));
+		memmove(offset+k+1,offset+k,(n-k)*sizeof(long));
+		cand[k] = T;
+		offset[k] = to;
+		n++;
+	}
+	for(k=0;k<n;k++){
+		if(cand[k] == I || cand[k] == J){
+			seedHi = k;
+		}
+	}
+	for(k=n-1;k>=0;k--){
+		if(cand[k] == I || cand[k] == J){
+			seedLo = k;
+		}
+	}
+	for(w=max;w>2;w/=2){
+		if(w>n || seedHi-seedLo+1>w){
+			continue;
+		}
+		start = seedHi-w+1 > 0 ? seedHi-w+1 : 0;
+		for(j=start;j<=seedLo && j+w<=n;j++){
+			PROF_ENTER(PHASE_COLLECT);
+			wide = CollectIsomorphicInsts(NULL,cand+j,w);
+			PROF_LEAVE();
+			if(wide == NULL){
+				PROF_COUNT(CNT_REJ_SHOULD);
+				continue;
+			}
+			PROF_COUNT(CNT_TREES);
+			if(wide->size>=2){
+				PROF_ENTER(PHASE_SCORE);
+				wide->score = CalcScore(wide);
+				wide = TrimTree(wide);
+				PROF_LEAVE();
+				if(wide->score < best->score){
+					destroy(best);
+					return wide;
+				}
+			}
+			destroy(wide);
+		}
+	}
+	return best;
+}
+
+//horizontal reductions
+//a tree of one associative op (or one integer min/max) that folds many
+//leaves into a single value: the leaves are vectorized like any other
+//pack and the tree is replaced by a log2 shuffle-reduce of that vector
+#define MAX_LEAVES 64
+
+typedef struct {
+  LLVMOpcode opcode;//LLVMSelect for min/max
+  LLVMIntPredicate pred;//min/max only
+  int isFloat;
+} ReductionKind;
+
+typedef struct {
+  ReductionKind kind;
+  LLVMValueRef root;
+  LLVMValueRef leaves[MAX_LEAVES];
+  LLVMValueRef users[MAX_LEAVES];//node that uses the leaf
+  int useOp[MAX_LEAVES];//operand of that node holding the leaf
+  int numLeaves;
+  valmap_t nodes;//instructions of the tree, compares of min/max included
+} Reduction;
+
+static bool AllowsReassoc(LLVMValueRef I)
+{
+	return HasFastMath(I,LLVMFastMathAllowReassoc);
+}
+
+//what kind of reduction node I could be, false if none
+static bool ReductionKindOf(LLVMValueRef I, ReductionKind *K)
+{
+	LLVMValueRef C;
+	K->opcode = LLVMGetInstructionOpcode(I);
+	K->pred = 0;
+	K->isFloat = 0;
+	switch(K->opcode){
+		case LLVMAdd:
+		case LLVMMul:
+		case LLVMAnd:
+		case LLVMOr:
+		case LLVMXor:
+			return LLVMGetTypeKind(LLVMTypeOf(I)) == LLVMIntegerTypeKind;
+		case LLVMFAdd:
+		case LLVMFMul:
+			//reassociating is only allowed with fast-math
+			K->isFloat = 1;
+			return AllowsReassoc(I);
+		case LLVMSelect:
+			//min/max: select (icmp pred x, y), x, y
+			C = LLVMGetOperand(I,0);
+			if(!LLVMIsAICmpInst(C) || LLVMGetTypeKind(LLVMTypeOf(I)) != LLVMIntegerTypeKind
+			   || LLVMGetOperand(C,0) != LLVMGetOperand(I,1) || LLVMGetOperand(C,1) != LLVMGetOperand(I,2)){
+				return false;
+			}
+			K->pred = LLVMGetICmpPredicate(C);
+			return K->pred != LLVMIntEQ && K->pred != LLVMIntNE;
+		default:
+			return false;
+	}
+}
+
+static bool SameKind(ReductionKind *a, ReductionKind *b)
+{
+	return a->opcode == b->opcode && a->pred == b->pred && a->isFloat == b->isFloat;
+}
+
+//operands of a node that take part in the reduction
+static int ReductionOperand(ReductionKind *K, int k)
+{
+	return K->opcode == LLVMSelect ? k+1 : k;
+}
+
+//true if V is an inner node of the tree under P: same kind, same block,
+//and nothing but P looks at it
+static bool IsInnerNode(LLVMValueRef V, LLVMValueRef P, ReductionKind *K)
+{
+	ReductionKind VK;
+	LLVMUseRef U;
+	LLVMValueRef user;
+	int uses = 0;
+	if(!LLVMIsAInstruction(V) || LLVMGetInstructionParent(V) != LLVMGetInstructionParent(P)){
+		return false;
+	}
+	if(LLVMGetInstructionOpcode(V) != K->opcode || LLVMGetInstructionOpcode(P) != K->opcode){
+		return false;
+	}
+	if(!ReductionKindOf(V,&VK) || !SameKind(&VK,K) || !ReductionKindOf(P,&VK) || !SameKind(&VK,K)){
+		return false;
+	}
+	for(U=LLVMGetFirstUse(V);U!=NULL;U=LLVMGetNextUse(U)){
+		user = LLVMGetUser(U);
+		if(user != P && !(K->opcode == LLVMSelect && user == LLVMGetOperand(P,0))){
+			return false;
+		}
+		uses++;
+	}
+	//a min/max child is read by the parent compare and select
+	if(uses != (K->opcode == LLVMSelect ? 2 : 1)){
+		return false;
+	}
+	//the compare of a min/max node must not be used elsewhere either
+	return K->opcode != LLVMSelect || (LLVMGetFirstUse(LLVMGetOperand(V,0)) != NULL
+	       && LLVMGetNextUse(LLVMGetFirstUse(LLVMGetOperand(V,0))) == NULL);
+}
 
+//a root is a reduction node that is not an inner node of another one
+static bool IsReductionRoot(LLVMValueRef I, ReductionKind *K)
+{
+	LLVMUseRef U = LLVMGetFirstUse(I);
+	LLVMValueRef user;
+	if(LLVMGetInstructionOpcode(I) != LLVMAdd && LLVMGetInstructionOpcode(I) != LLVMMul
+	   && LLVMGetInstructionOpcode(I) != LLVMAnd && LLVMGetInstructionOpcode(I) != LLVMOr
+	   && LLVMGetInstructionOpcode(I) != LLVMXor && LLVMGetInstructionOpcode(I) != LLVMFAdd
+	   && LLVMGetInstructionOpcode(I) != LLVMFMul && LLVMGetInstructionOpcode(I) != LLVMSelect){
+		return false;
+	}
+	if(!ReductionKindOf(I,K)){
+		return false;
+	}
+	if(U != NULL){
+		user = LLVMGetUser(U);
+		//a min/max child is first used by the parent compare
+		if(K->opcode == LLVMSelect && LLVMIsAICmpInst(user) && LLVMGetFirstUse(user)){
+			user = LLVMGetUser(LLVMGetFirstUse(user));
+		}
+		if(LLVMIsAInstruction(user) && IsInnerNode(I,user,K)){
+			return false;
+		}
+	}
+	return true;
 }
 
-static void Vectorize(VectorList* List)
+//collect the leaves under R->root, false if there are too many
+static bool CollectReduction(Reduction *R)
 {
-	VectorPair *ptr = NULL;
-	int i=0, flag =0;
-	LLVMValueRef I,J,newinsn,ev;
-	//create a valmap that maps original values (key) to vector values (data)
-	valmap_t op2vec;
-	return;
-	op2vec = valmap_create();
-	//for each pair (I,J) in L in dominance order:
-	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
-		I=ptr->pair[0];
-		J=ptr->pair[1];
-		//using gcc extension: variable length array of vectors
-		LLVMValueRef ops[LLVMGetNumOperands(I)];
-		for(i=0;i<LLVMGetNumOperands(I);i++){
-			if(LLVMIsAInstruction(LLVMGetOperand(I,i)) && LLVMIsAInstruction(LLVMGetOperand(J,i)) ){
-				//if vmap[Op(I,i)] is not found:
-				if(!valmap_check(op2vec,LLVMGetOperand(I,i))){
-					//corner case: operands of load are not vectorized
-					if(LLVMIsALoadInst(I)){
-						flag = 1;
-						break;
-					}
-					//ops[i] = packVector(op(I,i),op(J,i))
-					if(LLVMGetNextInstruction(LLVMGetOperand(J,i))){
-						LLVMPositionBuilderBefore(Builder,LLVMGetNextInstruction(LLVMGetOperand(J,i)));
-					}else{
-						LLVMPositionBuilderAtEnd(Builder,LLVMGetInstructionParent(LLVMGetOperand(J,i)));
-					}
-					ops[i] = assembleVec2(LLVMGetOperand(I,i),LLVMGetOperand(J,i));
-					//vmap[op(I,i)] = ops[i]
-					valmap_insert(op2vec,LLVMGetOperand(I,i),(void*)(ops[i]));
-					//vmap[op(J,i)] = ops[i]
-					valmap_insert(op2vec,LLVMGetOperand(J,i),(void*)(ops[i]));
-				}else{
-					//ops[i] = vmap[op(I)]
-					ops[i] = (LLVMValueRef)valmap_find(op2vec,LLVMGetOperand(I,i));
+	LLVMValueRef stack[MAX_LEAVES], N, op;
+	int sp = 0, k;
+	R->numLeaves = 0;
+	stack[sp++] = R->root;
+	valmap_insert(R->nodes,R->root,(void*)1);
+	while(sp > 0){
+		N = stack[--sp];
+		if(R->kind.opcode == LLVMSelect){
+			valmap_insert(R->nodes,LLVMGetOperand(N,0),(void*)1);
+		}
+		//right operand first so that leaves come out left to right
+		for(k=1;k>=0;k--){
+			op = LLVMGetOperand(N,ReductionOperand(&R->kind,k));
+			if(IsInnerNode(op,N,&R->kind)){
+				if(sp == MAX_LEAVES){
+					return false;
 				}
+				valmap_insert(R->nodes,op,(void*)1);
+				stack[sp++] = op;
+				continue;
+			}
+			if(R->numLeaves == MAX_LEAVES){
+				return false;
 			}
+			R->leaves[R->numLeaves] = op;
+			R->users[R->numLeaves] = N;
+			R->useOp[R->numLeaves] = ReductionOperand(&R->kind,k);
+			R->numLeaves++;
 		}
-		if(flag == 1){
-			ptr->insertAt0 = 0;
-			flag = 0;
-			continue;	
+	}
+	return true;
+}
+
+//combine a and b with the op of the reduction
+static LLVMValueRef BuildReductionOp(ReductionKind *K, LLVMValueRef a, LLVMValueRef b)
+{
+	if(K->opcode == LLVMSelect){
+		return LLVMBuildSelect(Ctx->Builder,LLVMBuildICmp(Ctx->Builder,K->pred,a,b,""),a,b,"");
+	}
+	return LLVMBuildBinOp(Ctx->Builder,K->opcode,a,b,"");
+}
+
+//cost of reducing a vector of n lanes instead of n-1 scalar ops
+static int ReductionCost(ReductionKind *K, int n)
+{
+	OpCost *c = &Cost.op[K->opcode][K->isFloat];
+	int steps = 0, vecOp, scalarOp;
+	for(;n>>steps > 1;steps++);
+	vecOp = c->vector[Cost.kind];
+	scalarOp = c->scalar[Cost.kind];
+	if(K->opcode == LLVMSelect){
+		vecOp += Cost.op[LLVMICmp][0].vector[Cost.kind];
+		scalarOp += Cost.op[LLVMICmp][0].scalar[Cost.kind];
+	}
+	if(vecOp < 0){
+		return 0;
+	}
+	return steps*(vecOp + Cost.op[LLVMShuffleVector][K->isFloat].vector[Cost.kind])
+	       + Cost.extract.scalar[Cost.kind] - (n-1)*scalarOp;
+}
+
+//vectorize the leaves of the tree at R->root and fold the vector
+static bool VectorizeReduction(Reduction *R)
+{
+	LLVMValueRef lanes[MAX_LANES], rest[MAX_LEAVES], users[MAX_LANES], T, vec = NULL, ev, sum;
+	LLVMValueRef mask[MAX_LANES];
+	int useOp[MAX_LANES];
+	int group[MAX_LEAVES];
+	int i, j, k, n = 0, best = -1, bestSize = 0, size, numRest = 0, score, w;
+	VectorList *List;
+	VectorPair *ptr;
+	LLVMUseRef U;
+	worklist_t dead;
+	bool only;
+
+	//the largest set of isomorphic leaves becomes the pack
+	for(i=0;i<R->numLeaves;i++){
+		if(!LLVMIsAInstruction(R->leaves[i])){
+			continue;
 		}
-		// Position builder just before I or J, pick the one later in BB
-		//but will this guarantee that it dominates all the uses of J??
-/*		if(dominBB(I,J)){
-			LLVMPositionBuilderBefore(Builder,J);	
-		}else{
-			LLVMPositionBuilderBefore(Builder,I);							
-		}*/
-		if(IsTransformable(ptr) == false){
-			printf("Error: this should not happen there should be a position to place the vector insn\n");	
+		for(size=0,j=0;j<R->numLeaves;j++){
+			if(LLVMIsAInstruction(R->leaves[j]) && IsIsomorphic(R->leaves[i],R->leaves[j])){
+				size++;
+			}
+		}
+		if(size > bestSize){
+			bestSize = size;
+			best = i;
 		}
-		//implement the generic vector insn builder
-		newinsn = Build(I,LLVMGetInstructionOpcode(I),LLVMGetNumOperands(I),ops,op2vec);
-//
-		valmap_insert(op2vec,I,(void*)newinsn);
-		valmap_insert(op2vec,J,(void*)newinsn);
 	}
-	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
-		LLVMValueRef indices[2];
-		I = ptr->pair[0];
-		J = ptr->pair[1];
-		if(ptr->insertAt0 != 1)
+	if(best < 0 || bestSize < 2){
+		return false;
+	}
+	//lanes in block order, a leaf used twice by the tree stays scalar
+	for(i=0;i<R->numLeaves;i++){
+		group[i] = 0;
+		if(!LLVMIsAInstruction(R->leaves[i]) || !IsIsomorphic(R->leaves[best],R->leaves[i])){
 			continue;
-		//if I has uses:
-		if(LLVMGetFirstUse(I) != NULL){
-			// Reposition builder
-			if(LLVMGetNextInstruction((LLVMValueRef)valmap_find(op2vec,I))){
-				LLVMPositionBuilderBefore (Builder,LLVMGetNextInstruction((LLVMValueRef)valmap_find(op2vec,I)));
-			}else{
-				LLVMPositionBuilderAtEnd(Builder,LLVMGetInstructionParent((LLVMValueRef)valmap_find(op2vec,I)));
-			}
-			//ev = BuildExtractElement(vmap[I],0) // index 0
-			if(LLVMIsAAllocaInst(I)){
-				indices[0] = LLVMConstInt(LLVMInt32Type(), (unsigned int)0, 0) ;
-				indices[1] = LLVMConstInt(LLVMInt32Type(), (unsigned int)0, 0) ;
-				ev = LLVMBuildGEP(Builder,(LLVMValueRef)valmap_find(op2vec,I),indices,(unsigned int)2,"");	
-			}else{
-				ev = LLVMBuildExtractElement (Builder, (LLVMValueRef)valmap_find(op2vec,I), LLVMConstInt(LLVMInt32Type(), (unsigned int)0, 0), "");
+		}
+		for(j=0;j<R->numLeaves;j++){
+			if(j != i && R->leaves[j] == R->leaves[i]){
+				break;
 			}
-			LLVMReplaceAllUsesWith(I,ev);
-			LLVMInstructionEraseFromParent(I);
 		}
-		if(LLVMGetFirstUse(J) != NULL){
-			// Reposition builder
-			if(LLVMGetNextInstruction((LLVMValueRef)valmap_find(op2vec,J))){
-				LLVMPositionBuilderBefore (Builder,LLVMGetNextInstruction((LLVMValueRef)valmap_find(op2vec,J)));
-			}else{
-				LLVMPositionBuilderAtEnd(Builder,LLVMGetInstructionParent((LLVMValueRef)valmap_find(op2vec,J)));
+		group[i] = j == R->numLeaves;
+	}
+	w = MaxLanes(R->leaves[best]);
+	for(size=0,i=0;i<R->numLeaves;i++){
+		size += group[i];
+	}
+	while(w > size){
+		w /= 2;
+	}
+	if(w < 2){
+		return false;
+	}
+	for(i=0;i<R->numLeaves;i++){
+		if(group[i] && n < w){
+			T = R->leaves[i];
+			for(k=n;k>0 && !dom(lanes[k-1],T);k--){
+				lanes[k] = lanes[k-1];
+				users[k] = users[k-1];
+				useOp[k] = useOp[k-1];
 			}
-			//ev = BuildExtractElement(vmap[J],0) // index 1
-			if(LLVMIsAAllocaInst(J)){
-				indices[0] = LLVMConstInt(LLVMInt32Type(), (unsigned int)0, 0) ;
-				indices[1] = LLVMConstInt(LLVMInt32Type(), (unsigned int)0, 1) ;
-				ev = LLVMBuildGEP(Builder,(LLVMValueRef)valmap_find(op2vec,J),indices,(unsigned int)2,"");	
-			}else{
-				ev = LLVMBuildExtractElement (Builder, (LLVMValueRef)valmap_find(op2vec,J), LLVMConstInt(LLVMInt32Type(), (unsigned int)1, 0), "");
+			lanes[k] = T;
+			users[k] = R->users[i];
+			useOp[k] = R->useOp[i];
+			n++;
+		}else{
+			rest[numRest++] = R->leaves[i];
+		}
+	}
+	PROF_ENTER(PHASE_COLLECT);
+	List = CollectIsomorphicInsts(NULL,lanes,w);
+	PROF_LEAVE();
+	if(List == NULL){
+		PROF_COUNT(CNT_REJ_SHOULD);
+		return false;
+	}
+	PROF_COUNT(CNT_TREES);
+	//lanes that only feed the tree are not extracted, the reduction reads the vector
+	score = CalcScore(List) + ReductionCost(&R->kind,w);
+	for(k=0;k<w;k++){
+		only = true;
+		for(U=LLVMGetFirstUse(lanes[k]);U!=NULL;U=LLVMGetNextUse(U)){
+			if(!valmap_check(R->nodes,LLVMGetUser(U)) && !valmap_check(List->visited,LLVMGetUser(U))){
+				only = false;
 			}
-			LLVMReplaceAllUsesWith(J,ev);
-			LLVMInstructionEraseFromParent(J);
-		}		
+		}
+		if(only){
+			score -= Cost.extract.scalar[Cost.kind];
+		}
 	}
-	valmap_destroy(op2vec);
-	//Remove any dead extractelements we inserted
+	List->score = score;
+	if(score >= 0){
+		Ctx->unprofitable++;
+		PROF_COUNT(CNT_REJ_SCORE);
+		destroy(List);
+		return false;
+	}
+	for(ptr=List->head;ptr!=NULL;ptr=ptr->next){
+		if(!IsTransformable(ptr,List,NULL,0)){
+			PROF_COUNT(CNT_REJ_TRANSFORM);
+			destroy(List);
+			return false;
+		}
+	}
+	pthread_mutex_lock(&ModuleLock);
+	PROF_ENTER(PHASE_VECTORIZE);
+	printList(List);
+	Vectorize(List);
+	//every lane is now an extract from the leaf vector
+	for(k=0;k<w;k++){
+		ev = LLVMGetOperand(users[k],useOp[k]);
+		if(!LLVMIsAExtractElementInst(ev) || !LLVMIsAConstantInt(LLVMGetOperand(ev,1))
+		   || LLVMConstIntGetZExtValue(LLVMGetOperand(ev,1)) != (unsigned long long)k
+		   || (vec && LLVMGetOperand(ev,0) != vec)){
+			vec = NULL;
+			break;
+		}
+		vec = LLVMGetOperand(ev,0);
+	}
+	if(vec == NULL){
+		//some pack stayed scalar, the scalar tree still computes the result
+		PROF_LEAVE();
+		pthread_mutex_unlock(&ModuleLock);
+		destroy(List);
+		return true;
+	}
+	//halve the vector until one lane is left
+	LLVMPositionBuilderBefore(Ctx->Builder,R->root);
+	for(n=w/2;n>=1;n/=2){
+		for(k=0;k<w;k++){
+			mask[k] = k < n ? LLVMConstInt(LLVMInt32Type(),n+k,0) : LLVMGetUndef(LLVMInt32Type());
+		}
+		vec = BuildReductionOp(&R->kind,vec,LLVMBuildShuffleVector(Ctx->Builder,vec,LLVMGetUndef(LLVMTypeOf(vec)),
+		                       LLVMConstVector(mask,w),"rdx.shuf"));
+	}
+	sum = LLVMBuildExtractElement(Ctx->Builder,vec,LLVMConstInt(LLVMInt32Type(),0,0),"rdx");
+	for(i=0;i<numRest;i++){
+		sum = BuildReductionOp(&R->kind,sum,rest[i]);
+	}
+	LLVMReplaceAllUsesWith(R->root,sum);
+	//the old tree and the lane extracts are dead now
+	dead = worklist_create();
+	worklist_insert(dead,R->root);
+	RemoveDead(dead);
+	worklist_destroy(dead);
+	PROF_LEAVE();
+	pthread_mutex_unlock(&ModuleLock);
+	Ctx->widthStats[w]++;
+	Ctx->reductions++;
+	PROF_COUNT(CNT_VECTORIZED);
+	PROF_ADD(CNT_SAVED,-score);
+	destroy(List);
+	return true;
+}
+
+//find the reduction trees of BB and vectorize the profitable ones
+static void SLPReductions(LLVMBasicBlockRef BB)
+{
+	LLVMValueRef I;
+	Reduction R;
+	valmap_t tried = valmap_create();
+	bool changed;
+	R.nodes = valmap_create();
+	do {
+		changed = false;
+		for(I=LLVMGetFirstInstruction(BB);I!=NULL;I=LLVMGetNextInstruction(I)){
+			if(valmap_check(tried,I) || !IsReductionRoot(I,&R.kind)){
+				continue;
+			}
+			valmap_insert(tried,I,(void*)1);
+			R.root = I;
+			valmap_clear(R.nodes);
+			if(CollectReduction(&R) && R.numLeaves > 2 && VectorizeReduction(&R)){
+				//the block changed under us, start over
+				depInvalidate();
+				changed = true;
+				break;
+			}
+		}
+	} while(changed);
+	valmap_destroy(R.nodes);
+	valmap_destroy(tried);
 }
 
+//a tree found in the current round and the seed pair it grew from
+typedef struct {
+  VectorList *list;//NULL once a better tree took one of its lanes
+  SeedBucket *bucket;
+  int a, c;
+  int id;//order it was found in, breaks ties between equal scores
+} Candidate;
 
-static void printList(VectorList *List)
+//the trees of one round, kept free of conflicts: no two share a lane
+typedef struct {
+  Candidate *items;
+  int count;
+  int cap;
+  valmap_t owner;//lane -> index of the candidate it belongs to+1
+  int lost;//trees dropped for a conflict or left scalar this round
+} CandidateSet;
+
+static void candidateClaim(CandidateSet *S, int idx, bool claim)
 {
-	VectorPair* ptr = NULL;
-	printf("VectorList instruction pairs:\n");
-	for(ptr=List->head;ptr!=NULL;ptr=ptr->next)
-	{
-		printf("%s\n",LLVMPrintValueToString(ptr->pair[0]));
-		printf("%s\n",LLVMPrintValueToString(ptr->pair[1]));
-	}
+  VectorPair *ptr;
+  int k;
+  for(ptr=S->items[idx].list->head;ptr!=NULL;ptr=ptr->next){
+    for(k=0;k<ptr->lanes;k++){
+      if(claim)
+        valmap_insert(S->owner,ptr->pair[k],(void*)(long)(idx+1));
+      else
+        valmap_remove(S->owner,ptr->pair[k]);
+    }
+  }
+}
+
+//keep list if it scores better than every kept tree it shares a lane with,
+//those are dropped; otherwise list is destroyed
+static void candidateOffer(CandidateSet *S, VectorList *list, SeedBucket *bucket, int a, int c)
+{
+  VectorPair *ptr;
+  Candidate *o;
+  int k;
+  for(ptr=list->head;ptr!=NULL;ptr=ptr->next){
+    for(k=0;k<ptr->lanes;k++){
+      if(valmap_check(S->owner,ptr->pair[k])){
+        o = &S->items[(long)valmap_find(S->owner,ptr->pair[k])-1];
+        if(o->list->score <= list->score){
+          S->lost++;
+          destroy(list);
+          return;
+        }
+      }
+    }
+  }
+  for(ptr=list->head;ptr!=NULL;ptr=ptr->next){
+    for(k=0;k<ptr->lanes;k++){
+      if(valmap_check(S->owner,ptr->pair[k])){
+        o = &S->items[(long)valmap_find(S->owner,ptr->pair[k])-1];
+        candidateClaim(S,o-S->items,false);
+        S->lost++;
+        destroy(o->list);
+        o->list = NULL;
+      }
+    }
+  }
+  if(S->count == S->cap){
+    S->cap = S->cap ? 2*S->cap : 64;
+    S->items = (Candidate*) realloc(S->items,S->cap*sizeof(Candidate));
+  }
+  o = &S->items[S->count];
+  o->list = list;
+  o->bucket = bucket;
+  o->a = a;
+  o->c = c;
+  o->id = S->count;
+  candidateClaim(S,S->count++,true);
+}
+
+//I or J is a lane of a kept tree: a tree seeded by them would have to beat
+//it, the seed waits for the next round instead of being tried
+static bool candidateCovers(CandidateSet *S, LLVMValueRef I, LLVMValueRef J)
+{
+  if(!valmap_check(S->owner,I) && !valmap_check(S->owner,J))
+    return false;
+  S->lost++;
+  return true;
+}
+
+//best score first, dropped candidates last
+static int candidateCompare(const void *x, const void *y)
+{
+  const Candidate *p = (const Candidate*)x, *q = (const Candidate*)y;
+  if(p->list == NULL || q->list == NULL)
+    return (p->list == NULL) - (q->list == NULL);
+  if(p->list->score != q->list->score)
+    return p->list->score < q->list->score ? -1 : 1;
+  return p->id - q->id;
+}
+
+//vectorize *list if it is still transformable, true when it was; a pack
+//that can not be moved is cut off with its subtree as long as what is
+//left still pays, *list is then replaced by the part that was vectorized
+static bool vectorizeList(VectorList **out)
+{
+  VectorList *list = *out;
+  VectorPair *ptr;
+  valmap_t cut;
+  PROF_ENTER(PHASE_TRANSFORM);
+  ptr = list->head;
+  while(ptr!=NULL){
+    if(IsTransformable(ptr,list,NULL,0)){
+      ptr = ptr->next;
+      continue;
+    }
+    if(ptr->parent == NULL){
+      PROF_COUNT(CNT_REJ_TRANSFORM);
+      PROF_LEAVE();
+      return false;
+    }
+    cut = poolMap();
+    valmap_insert(cut,ptr->pair[0],(void*)1);
+    *out = CopyUncut(list,cut);
+    poolMapRelease(cut);
+    destroy(list);
+    list = *out;
+    if(list->size < 2 || list->score >= 0){
+      PROF_COUNT(CNT_REJ_TRANSFORM);
+      PROF_LEAVE();
+      return false;
+    }
+    //the packs left may be placed differently now, check them all again
+    ptr = list->head;
+  }
+  PROF_LEAVE();
+  //update stats
+  if(list->size > 5){
+    Ctx->stats[5]++;
+  }else{
+    Ctx->stats[list->size]++;
+  }
+  Ctx->widthStats[list->head->lanes]++;
+  Ctx->trimmed += list->trimmed;
+  PROF_COUNT(CNT_VECTORIZED);
+  PROF_ADD(CNT_SAVED,-list->score);
+  pthread_mutex_lock(&ModuleLock);
+  PROF_ENTER(PHASE_VECTORIZE);
+  printList(list);
+  Vectorize(list);
+  PROF_LEAVE();
+  pthread_mutex_unlock(&ModuleLock);
+  depInvalidate();
+  return true;
+}
+
+static double secondsSince(struct timespec *t0)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC,&now);
+	return (now.tv_sec - t0->tv_sec) + (now.tv_nsec - t0->tv_nsec)*1e-9;
+}
+
+//the current function or the whole module used up its time
+static bool OverBudget()
+{
+	return (FunctionBudget > 0 && secondsSince(&Ctx->started) > FunctionBudget) ||
+	       (ModuleBudget > 0 && secondsSince(&ModuleStart) > ModuleBudget);
 }
 
 static void SLPOnBasicBlock(LLVMBasicBlockRef BB)
 {
   LLVMValueRef I, J;
   int changed;
-  int i=0;
-  VectorList *old_best_list = NULL;
+  int round=0;
   VectorList *newList;
   VectorPair *ptr = NULL;
- //1 pass per block
+  SeedTable Seeds = {NULL,0,0,NULL,NULL,0};
+  CandidateSet Cands = {NULL,0,0,NULL,0};
+  Candidate *cand;
+  valmap_t taken;
+  int a,b,c,k;
+ //the work on a block grows with its size, not faster: all its trees
+ //share BlockPacks packs per instruction
+ Ctx->packsLeft = 0;
+ for(I=LLVMGetFirstInstruction(BB);I!=NULL;I=LLVMGetNextInstruction(I))
+   Ctx->packsLeft += BlockPacks;
+ //trees that fold into one value first, their inner nodes are no seeds
+ SLPReductions(BB);
+ Cands.owner = poolMap();
+ taken = poolMap();
+ //every round collects all trees of the block, keeps a set of them that
+ //share no lane and vectorizes it best first; a tree that lost a lane to a
+ //better one is found again next round, until nothing profitable is left
+ //or no tree was lost
  do {
     changed = 0;
-    
-	old_best_list=NULL;
-	//for each instruction I in BB
+	Cands.count = 0;
+	Cands.lost = 0;
+	valmap_clear(Cands.owner);
+	valmap_clear(taken);
+	//bucket the candidates by signature, only pairs inside a bucket can be isomorphic
+	PROF_ENTER(PHASE_SEED);
+	seedCollect(&Seeds,BB);
+	//out of time the trees found so far are still vectorized
+	for(b=0;b<Seeds.count && !OverBudget() && Ctx->packsLeft > 0;b++)
+	 {
+	  SeedBucket *bucket = &Seeds.buckets[Seeds.order[b]];
+	//for each instruction I in the bucket
 	//start from last instruction and keep searching for isomorphic insts
-	for(I=LLVMGetLastInstruction(BB);
-   	   I!=NULL;
-   	   I=LLVMGetPreviousInstruction(I))
+	for(a=bucket->size-1;a>=0 && Ctx->packsLeft > 0;a--)
    	 {      
       	// find a match with I
+		I = bucket->insts[a];
 		//for each instruction J such that J comes before I
-		for(J=LLVMGetFirstInstruction(BB);J!=I;J=LLVMGetNextInstruction(J)){
+		//(only the closest SEED_WINDOW members, lanes are usually near each other)
+		for(c=a-1;c>=0 && c>=a-SEED_WINDOW;c--){
+			J = bucket->insts[c];
+			Ctx->seedPairs++;
+			PROF_COUNT(CNT_PAIRS);
 			//if isomorphic(I,J)
-			if(IsIsomorphic(I,J)){
+			if(!candidateCovers(&Cands,I,J) && IsIsomorphic(I,J)){
+				LLVMValueRef seed[2] = {J,I};
 	 			newList = NULL;
 				//list = collectisomorphicinsta(list,I,J)
-				newList = CollectIsomorphicInsts(newList,I,J);
+				PROF_ENTER(PHASE_COLLECT);
+				newList = CollectIsomorphicInsts(newList,seed,2);
+				PROF_LEAVE();
 				if(newList == NULL){
+					PROF_COUNT(CNT_REJ_SHOULD);
 					continue;	
 				}
+				PROF_COUNT(CNT_TREES);
 				//if size of list>=2
 				if(newList->size<2){
+					PROF_COUNT(CNT_REJ_SIZE);
 					destroy(newList);
 					newList = NULL;
 					continue;
 				}
-				//if it is transformable
-/*				for(ptr=newList->head;ptr!=NULL;ptr=ptr->next){
-					if(!IsTransformable(ptr)){
-						destroy(newList);
-						newList = NULL;
-						break;
-					}	
-				}
-				if(newList == NULL){
-					continue;	
-				}*/
 				//calc score
+				PROF_ENTER(PHASE_SCORE);
 				newList->score=CalcScore(newList);
-				//this is first list no prev best list
-				if(old_best_list == NULL){
-					old_best_list = newList;
-					newList = NULL;
-					continue;	
-				}
-				//if score is best score replace best list
-				//old list was there replace old
-				if(newList->score < old_best_list->score){
-/*					for(ptr=newList->head;ptr!=NULL;ptr=ptr->next){
-						if(!IsTransformable(ptr)){
-							destroy(newList);
-							newList = NULL;
-							break;
-						}	
-					}
-					if(newList == NULL){
-						continue;	
-					}*/
-					destroy(old_best_list);
-					old_best_list = NULL;
-					old_best_list = newList;
-					newList = NULL;
-				}else{
-					//score is not best discard list
-					destroy(newList);
-					newList = NULL;
-				}
+				newList = TrimTree(newList);
+				PROF_LEAVE();
+				candidateOffer(&Cands,newList,bucket,a,c);
 			}
 		}
     }
-	//found best list
-	if(old_best_list){
-		for(ptr=old_best_list->head;ptr!=NULL;ptr=ptr->next){
-			if(!IsTransformable(ptr)){
-				destroy(old_best_list);
-				old_best_list = NULL;
+	 }
+	//see if the seeds of the kept trees chain into wider packs
+	for(k=0;k<Cands.count;k++){
+		cand = &Cands.items[k];
+		if(cand->list){
+			cand->list = widenSeed(cand->bucket,cand->a,cand->c,cand->list);
+		}
+	}
+	PROF_LEAVE();
+	qsort(Cands.items,Cands.count,sizeof(Candidate),candidateCompare);
+	for(k=0;k<Cands.count && Cands.items[k].list;k++){
+		newList = Cands.items[k].list;
+		Cands.items[k].list = NULL;
+		//even the best list may cost more than the scalar code it replaces
+		if(newList->score >= 0){
+			Ctx->unprofitable++;
+			PROF_COUNT(CNT_REJ_SCORE);
+			destroy(newList);
+			continue;
+		}
+		//a widened tree may overlap one picked before it
+		for(ptr=newList->head;ptr!=NULL;ptr=ptr->next){
+			for(a=0;a<ptr->lanes && !valmap_check(taken,ptr->pair[a]);a++);
+			if(a<ptr->lanes){
 				break;
-			}	
+			}
 		}
-		if(old_best_list){
-		//update stats
-			if(old_best_list->size > 5){
-				stats[5]++;	
-			}else{
-				stats[old_best_list->size]++;
+		if(ptr == NULL && vectorizeList(&newList)){
+			for(ptr=newList->head;ptr!=NULL;ptr=ptr->next){
+				for(a=0;a<ptr->lanes;a++){
+					valmap_insert(taken,ptr->pair[a],(void*)1);
+				}
 			}
-			//vectorize the list
-			printList(old_best_list);
-			Vectorize(old_best_list);
-//			printf("vectorized a  list\n");
-			//destroy the list
-			destroy(old_best_list);
-			old_best_list = NULL;
-	//		printf("yes\t");
-			//changed the BB move on to next BB since i=1
-			changed = 1;	
+			changed = 1;
+		}else{
+			Cands.lost++;
+		}
+		destroy(newList);
+	}
+	round++;
+  } while(changed && Cands.lost && round<MaxRounds && !OverBudget() && Ctx->packsLeft > 0);
+  if(Ctx->packsLeft <= 0)
+    Ctx->cutBlocks++;
+  free(Cands.items);
+  poolMapRelease(Cands.owner);
+  poolMapRelease(taken);
+  seedDestroy(&Seeds);
+  regDestroy();
+  orderDestroy();
+  depDestroy();
+  arenaReset();
+}
+
+//block execution counts from SLP_BLOCK_PROFILE, sorted by function and block
+typedef struct {
+  char *function;
+  char *block;
+  double count;
+} BlockCount;
+
+static BlockCount *BlockCounts;
+static int NumBlockCounts;
+
+static int blockCountCompare(const void *x, const void *y)
+{
+  const BlockCount *a = (const BlockCount*)x, *b = (const BlockCount*)y;
+  int c = strcmp(a->function,b->function);
+  return c ? c : strcmp(a->block,b->block);
+}
+
+//read one count per line, lines starting with '#' are comments:
+//  <function> <block> <count>
+//an unnamed block is known by its position in the function, as #<n>
+static void profileLoad(const char *path)
+{
+	FILE *fp = fopen(path,"r");
+	char line[512], fn[240], bb[240];
+	double count;
+	int lineNo = 0, cap = 0;
+	if(fp == NULL){
+		fprintf(stderr,"SLP: cannot open block profile %s\n",path);
+		return;
+	}
+	while(fgets(line,sizeof(line),fp)){
+		lineNo++;
+		if(sscanf(line,"%239s",fn) != 1 || fn[0] == '#'){
+			continue;
 		}
+		if(sscanf(line,"%239s %239s %lf",fn,bb,&count) != 3 || count < 0){
+			fprintf(stderr,"SLP: %s:%d: ignoring malformed profile line\n",path,lineNo);
+			continue;
+		}
+		if(NumBlockCounts == cap){
+			cap = cap ? 2*cap : 256;
+			BlockCounts = (BlockCount*) realloc(BlockCounts,cap*sizeof(BlockCount));
+		}
+		BlockCounts[NumBlockCounts].function = strdup(fn);
+		BlockCounts[NumBlockCounts].block = strdup(bb);
+		BlockCounts[NumBlockCounts].count = count;
+		NumBlockCounts++;
+	}
+	fclose(fp);
+	qsort(BlockCounts,NumBlockCounts,sizeof(BlockCount),blockCountCompare);
+}
+
+static void profileDestroy()
+{
+	int i;
+	for(i=0;i<NumBlockCounts;i++){
+		free(BlockCounts[i].function);
+		free(BlockCounts[i].block);
+	}
+	free(BlockCounts);
+	BlockCounts = NULL;
+	NumBlockCounts = 0;
+}
+
+//the count of block bb of fn: 1 when the profile has it, 0 when it only
+//has other blocks of fn, -1 when it does not know fn
+static int profileFind(const char *fn, const char *bb, double *count)
+{
+	BlockCount key = {(char*)fn,(char*)bb,0};
+	int lo = 0, hi = NumBlockCounts, mid;
+	while(lo < hi){
+		mid = (lo+hi)/2;
+		if(blockCountCompare(&BlockCounts[mid],&key) < 0){
+			lo = mid+1;
+		}else{
+			hi = mid;
+		}
+	}
+	*count = 0;
+	if(lo < NumBlockCounts && blockCountCompare(&BlockCounts[lo],&key) == 0){
+		*count = BlockCounts[lo].count;
+		return 1;
 	}
-	i++;
-  } while(changed && i<3);//loop while changes are being made or number of lists created is less than 3
+	if((lo < NumBlockCounts && strcmp(BlockCounts[lo].function,fn) == 0) ||
+	   (lo > 0 && strcmp(BlockCounts[lo-1].function,fn) == 0)){
+		return 0;
+	}
+	return -1;
+}
+
+//how often a block runs: its profile count, or 10 per enclosing loop
+typedef struct {
+  LLVMBasicBlockRef BB;
+  double freq;
+  int pos;
+} BlockHeat;
+
+static int blockHeatCompare(const void *x, const void *y)
+{
+  const BlockHeat *a = (const BlockHeat*)x, *b = (const BlockHeat*)y;
+  if(a->freq != b->freq)
+    return a->freq > b->freq ? -1 : 1;
+  return a->pos - b->pos;
 }
 
 static void SLPOnFunction(LLVMValueRef F) 
 {
   LLVMBasicBlockRef BB;
-  for(BB=LLVMGetFirstBasicBlock(F);
-      BB!=NULL;
-      BB=LLVMGetNextBasicBlock(BB))
+  LLVMLoopInfoRef LI;
+  LLVMLoopRef Loop;
+  worklist_t blocks;
+  valmap_t depth = valmap_create();
+  BlockHeat *heat;
+  const char *fn;
+  char name[32];
+  double count;
+  size_t len;
+  int n = 0, i, d, known;
+  clock_gettime(CLOCK_MONOTONIC,&Ctx->started);
+  //loops of one block with a preheader, their PHIs may be packed. the loop
+  //analysis builds on the same helpers as dom(), so it holds ModuleLock too
+  Ctx->Loops = valmap_create();
+  pthread_mutex_lock(&ModuleLock);
+  LI = LLVMCreateLoopInfo(F);
+  for(Loop=LLVMGetFirstLoop(LI);Loop!=NULL;Loop=LLVMGetNextLoop(LI,Loop))
+    {
+      blocks = LLVMGetBlocksInLoop(Loop);
+      for(i=0;!worklist_empty(blocks);i++)
+        {
+          BB = LLVMValueAsBasicBlock(worklist_pop(blocks));
+          d = valmap_check(depth,LLVMBasicBlockAsValue(BB)) ? (int)(long)valmap_find(depth,LLVMBasicBlockAsValue(BB)) : 0;
+          valmap_insert(depth,LLVMBasicBlockAsValue(BB),(void*)(long)(d+1));
+        }
+      if(i == 1 && LLVMGetPreheader(Loop))
+        valmap_insert(Ctx->Loops,LLVMBasicBlockAsValue(BB),(void*)LLVMGetPreheader(Loop));
+      worklist_destroy(blocks);
+    }
+  LLVMDisposeLoopInfo(LI);
+  pthread_mutex_unlock(&ModuleLock);
+  //hottest blocks first, so a budget that runs out leaves the cold ones
+  heat = (BlockHeat*) malloc(LLVMCountBasicBlocks(F)*sizeof(BlockHeat));
+  fn = LLVMGetValueName2(F,&len);
+  known = NumBlockCounts ? profileFind(fn,"",&count) >= 0 : 0;
+  for(BB=LLVMGetFirstBasicBlock(F);BB!=NULL;BB=LLVMGetNextBasicBlock(BB))
+    {
+      heat[n].BB = BB;
+      heat[n].pos = n;
+      snprintf(name,sizeof(name),"#%d",n);
+      //a block the profile does not list is weighed by its loop depth, as
+      //without a profile, rather than taken to have never run
+      if(!known || profileFind(fn,LLVMGetBasicBlockName(BB)[0] ? LLVMGetBasicBlockName(BB) : name,&heat[n].freq) != 1)
+        {
+          d = valmap_check(depth,LLVMBasicBlockAsValue(BB)) ? (int)(long)valmap_find(depth,LLVMBasicBlockAsValue(BB)) : 0;
+          for(heat[n].freq=1;d>0;d--)
+            heat[n].freq *= 10;
+        }
+      n++;
+    }
+  qsort(heat,n,sizeof(BlockHeat),blockHeatCompare);
+  for(i=0;i<n;i++)
     {
-      SLPOnBasicBlock(BB);
+      if(heat[i].freq < HotThreshold)
+        {
+          Ctx->coldBlocks++;
+          continue;
+        }
+      if(OverBudget())
+        {
+          Ctx->budgetBlocks++;
+          continue;
+        }
+      PROF_ENTER(PHASE_OTHER);
+      SLPOnBasicBlock(heat[i].BB);
+      PROF_LEAVE();
     }
+  free(heat);
+  valmap_destroy(depth);
+  valmap_destroy(Ctx->Loops);
+  Ctx->Loops = NULL;
+}
+
+//one function of the module, its printList output is staged until all are done
+typedef struct {
+  LLVMValueRef F;
+  char *log;
+  size_t logLen;
+} FunctionTask;
+
+//tasks [head,tail) still belong to a worker, the owner takes from the head
+//and idle workers steal from the tail
+typedef struct {
+  pthread_mutex_t lock;
+  int head;
+  int tail;
+} WorkQueue;
+
+typedef struct {
+  SLPContext ctx;
+  WorkQueue queue;
+  pthread_t thread;
+  int id;
+} Worker;
+
+static FunctionTask *Tasks;
+static Worker *Workers;
+static int NumWorkers;
+
+static int takeTask(WorkQueue *q, bool steal)
+{
+	int t = -1;
+	pthread_mutex_lock(&q->lock);
+	if(q->head < q->tail){
+		t = steal ? --q->tail : q->head++;
+	}
+	pthread_mutex_unlock(&q->lock);
+	return t;
+}
+
+static void *SLPWorker(void *arg)
+{
+	Worker *W = (Worker*)arg;
+	int t, v;
+	Ctx = &W->ctx;
+	for(;;){
+		t = takeTask(&W->queue,false);
+		for(v=1;t<0 && v<NumWorkers;v++){
+			t = takeTask(&Workers[(W->id+v)%NumWorkers].queue,true);
+		}
+		if(t < 0){
+			//nobody has work left, and no new work is ever queued
+			break;
+		}
+		Ctx->log = open_memstream(&Tasks[t].log,&Tasks[t].logLen);
+		SLPOnFunction(Tasks[t].F);
+		fclose(Ctx->log);
+		Ctx->log = NULL;
+	}
+	return NULL;
+}
+
+#ifdef SLP_PROFILE
+static const char *PhaseNames[NUM_PHASES] = {"other","seed","collect","score","transformable","vectorize"};
+static const char *CounterNames[NUM_COUNTERS] = {"pairs_tried","trees_built","rejected_should_vectorize",
+  "rejected_size","rejected_score","rejected_not_transformable","lists_vectorized","estimated_cycles_saved"};
+
+static void profReport(Profile *P)
+{
+	const char *format = getenv("SLP_STATS") ? getenv("SLP_STATS") : "table";
+	FILE *out = getenv("SLP_STATS_FILE") ? fopen(getenv("SLP_STATS_FILE"),"w")
+	          : strcmp(format,"json") == 0 ? stderr : stdout;
+	double total = 0;
+	int i;
+	if(out == NULL){
+		fprintf(stderr,"SLP: cannot open %s\n",getenv("SLP_STATS_FILE"));
+		return;
+	}
+	for(i=0;i<NUM_PHASES;i++){
+		total += P->seconds[i];
+	}
+	if(strcmp(format,"json") == 0){
+		fprintf(out,"{\n  \"phases\": {");
+		for(i=0;i<NUM_PHASES;i++){
+			fprintf(out,"%s\"%s\": %.6f",i ? ", " : "",PhaseNames[i],P->seconds[i]);
+		}
+		fprintf(out,"},\n  \"counters\": {");
+		for(i=0;i<NUM_COUNTERS;i++){
+			fprintf(out,"%s\"%s\": %ld",i ? ", " : "",CounterNames[i],P->counters[i]);
+		}
+		fprintf(out,"}\n}\n");
+	}else{
+		fprintf(out,"%-28s %10s %6s\n","Phase","Seconds","%");
+		for(i=0;i<NUM_PHASES;i++){
+			fprintf(out,"%-28s %10.4f %5.1f%%\n",PhaseNames[i],P->seconds[i],total > 0 ? 100*P->seconds[i]/total : 0);
+		}
+		fprintf(out,"%-28s %10.4f\n","total",total);
+		fprintf(out,"%-28s %10s\n","Counter","Value");
+		for(i=0;i<NUM_COUNTERS;i++){
+			fprintf(out,"%-28s %10ld\n",CounterNames[i],P->counters[i]);
+		}
+	}
+	if(out != stdout && out != stderr){
+		fclose(out);
+	}
 }
+#endif
 
 void SLP_C(LLVMModuleRef Module)
 {
   LLVMValueRef F;
-  int i=0;
-	Builder = LLVMCreateBuilder();
+  int i=0, w, n=0;
+	SLPContext total;
+	struct rusage usage;
+	TD = LLVMGetModuleDataLayout(Module);
+	//cost model: SLP_TARGET picks the tables, SLP_COST_TABLE overrides entries
+	costSelectTarget("avx2");
+	if(getenv("SLP_TARGET") && !costSelectTarget(getenv("SLP_TARGET"))){
+		fprintf(stderr,"SLP: unknown target %s, using %s\n",getenv("SLP_TARGET"),Cost.target);
+	}
+	if(getenv("SLP_COST_TABLE")){
+		costLoadTable(getenv("SLP_COST_TABLE"));
+	}
+	//SLP_MATH_TABLE adds vector forms of math calls, of a SIMD library say
+	MathReadNone = LLVMGetEnumAttributeKindForName("readnone",8);
+	if(getenv("SLP_MATH_TABLE") && MathLoaded == NULL){
+		mathLoadTable(getenv("SLP_MATH_TABLE"),Cost.op[LLVMCall][1].scalar[COST_THROUGHPUT]);
+	}
+	Cost.kind = COST_THROUGHPUT;
+	if(getenv("SLP_COST_KIND") && strcmp(getenv("SLP_COST_KIND"),"latency") == 0){
+		Cost.kind = COST_LATENCY;
+	}
+	if(getenv("SLP_VECTOR_BITS")){
+		VectorBits = atoi(getenv("SLP_VECTOR_BITS"));
+	}
+	if(getenv("SLP_MAX_ROUNDS") && atoi(getenv("SLP_MAX_ROUNDS")) > 0){
+		MaxRounds = atoi(getenv("SLP_MAX_ROUNDS"));
+	}
+	if(getenv("SLP_MAX_TREE_DEPTH") && atoi(getenv("SLP_MAX_TREE_DEPTH")) >= 0){
+		MaxTreeDepth = atoi(getenv("SLP_MAX_TREE_DEPTH"));
+	}
+	if(getenv("SLP_MAX_TREE_NODES") && atoi(getenv("SLP_MAX_TREE_NODES")) > 0){
+		MaxTreeNodes = atoi(getenv("SLP_MAX_TREE_NODES"));
+	}
+	if(getenv("SLP_BLOCK_PACKS") && atoi(getenv("SLP_BLOCK_PACKS")) > 0){
+		BlockPacks = atoi(getenv("SLP_BLOCK_PACKS"));
+	}
+	//block frequencies come from SLP_BLOCK_PROFILE, or from loop nesting
+	if(getenv("SLP_HOT_THRESHOLD")){
+		HotThreshold = atof(getenv("SLP_HOT_THRESHOLD"));
+	}
+	FunctionBudget = getenv("SLP_FUNCTION_BUDGET_MS") ? atof(getenv("SLP_FUNCTION_BUDGET_MS"))/1000 : 0;
+	ModuleBudget = getenv("SLP_MODULE_BUDGET_MS") ? atof(getenv("SLP_MODULE_BUDGET_MS"))/1000 : 0;
+	if(getenv("SLP_BLOCK_PROFILE")){
+		profileLoad(getenv("SLP_BLOCK_PROFILE"));
+	}
+	clock_gettime(CLOCK_MONOTONIC,&ModuleStart);
+	//every function with a body is a task
+  for(F=LLVMGetFirstFunction(Module); 
+      F!=NULL;
+      F=LLVMGetNextFunction(F))
+    {
+      if(LLVMGetFirstBasicBlock(F))
+        n++;
+    }
+	Tasks = (FunctionTask*) calloc(n ? n : 1,sizeof(FunctionTask));
+	n = 0;
   for(F=LLVMGetFirstFunction(Module); 
       F!=NULL;
       F=LLVMGetNextFunction(F))
     {
-      SLPOnFunction(F);
+      if(LLVMGetFirstBasicBlock(F))
+        Tasks[n++].F = F;
     }
+	//SLP_THREADS workers, one per online CPU by default
+	NumWorkers = getenv("SLP_THREADS") ? atoi(getenv("SLP_THREADS")) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(NumWorkers > n){
+		NumWorkers = n;
+	}
+	if(NumWorkers < 1){
+		NumWorkers = 1;
+	}
+	Workers = (Worker*) calloc(NumWorkers,sizeof(Worker));
+	for(w=0;w<NumWorkers;w++){
+		Workers[w].id = w;
+		Workers[w].ctx.Builder = LLVMCreateBuilder();
+		pthread_mutex_init(&Workers[w].queue.lock,NULL);
+		//contiguous shares keep neighbouring functions on one worker
+		Workers[w].queue.head = (int)((long)n*w/NumWorkers);
+		Workers[w].queue.tail = (int)((long)n*(w+1)/NumWorkers);
+	}
+	//the calling thread is worker 0, a single worker runs without threads
+	for(w=1;w<NumWorkers;w++){
+		pthread_create(&Workers[w].thread,NULL,SLPWorker,&Workers[w]);
+	}
+	SLPWorker(&Workers[0]);
+	//queues are only torn down once nobody can steal from them anymore
+	for(w=1;w<NumWorkers;w++){
+		pthread_join(Workers[w].thread,NULL);
+	}
+	memset(&total,0,sizeof(total));
+	for(w=0;w<NumWorkers;w++){
+		for(i=0;i<6;i++){
+			total.stats[i] += Workers[w].ctx.stats[i];
+		}
+		for(i=0;i<=MAX_LANES;i++){
+			total.widthStats[i] += Workers[w].ctx.widthStats[i];
+		}
+		total.seedPairs += Workers[w].ctx.seedPairs;
+		total.unprofitable += Workers[w].ctx.unprofitable;
+		total.reductions += Workers[w].ctx.reductions;
+		total.coldBlocks += Workers[w].ctx.coldBlocks;
+		total.budgetBlocks += Workers[w].ctx.budgetBlocks;
+		total.cutBlocks += Workers[w].ctx.cutBlocks;
+		total.trimmed += Workers[w].ctx.trimmed;
+		total.fused += Workers[w].ctx.fused;
+		total.allocs += Workers[w].ctx.allocs;
+		total.mallocs += Workers[w].ctx.mallocs;
+#ifdef SLP_PROFILE
+		for(i=0;i<NUM_PHASES;i++){
+			total.prof.seconds[i] += Workers[w].ctx.prof.seconds[i];
+		}
+		for(i=0;i<NUM_COUNTERS;i++){
+			total.prof.counters[i] += Workers[w].ctx.prof.counters[i];
+		}
+#endif
+		Ctx = &Workers[w].ctx;
+		poolDestroy();
+		LLVMDisposeBuilder(Workers[w].ctx.Builder);
+		pthread_mutex_destroy(&Workers[w].queue.lock);
+	}
+	//staged output in module order, so it does not depend on the schedule
+	for(i=0;i<n;i++){
+		fwrite(Tasks[i].log,1,Tasks[i].logLen,stdout);
+		free(Tasks[i].log);
+	}
+	free(Tasks);
+	profileDestroy();
+	free(Workers);
+	Tasks = NULL;
+	Workers = NULL;
+	Ctx = NULL;
 	printf("SLP Results\n");
 	printf("SIZE:\tCount\n");
 	for(i=2;i<6;i++){
-			printf("%4d:\t%d\n",i,stats[i]);
+			printf("%4d:\t%d\n",i,total.stats[i]);
+	}
+	printf("WIDTH:\tCount\n");
+	for(i=2;i<=MAX_LANES;i*=2){
+			printf("%4d:\t%d\n",i,total.widthStats[i]);
 	}
+	printf("Seed pairs examined: %ld\n",total.seedPairs);
+	printf("Reductions vectorized: %ld\n",total.reductions);
+	printf("Blocks skipped: %ld cold, %ld over budget\n",total.coldBlocks,total.budgetBlocks);
+	printf("Blocks cut short at the pack budget: %ld\n",total.cutBlocks);
+	printf("Packs trimmed off trees: %ld\n",total.trimmed);
+	printf("Multiply-adds fused: %ld\n",total.fused);
+	printf("Unprofitable lists rejected: %ld (%s, %s)\n",total.unprofitable,Cost.target,
+	       Cost.kind == COST_LATENCY ? "latency" : "throughput");
+	getrusage(RUSAGE_SELF,&usage);
+	printf("Lists, pairs and valmaps: %ld (%ld from malloc), peak RSS %ld kB\n",total.allocs,total.mallocs,usage.ru_maxrss);
+#ifdef SLP_PROFILE
+	profReport(&total.prof);
+#endif
 }
 
 
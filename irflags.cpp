@@ -0,0 +1,45 @@
+//IR flags the C API of this LLVM can not read
+#include "llvm/IR/Operator.h"
+#include "llvm/IR/Instructions.h"
+#include "llvm-c/Core.h"
+#include "irflags.h"
+
+using namespace llvm;
+
+unsigned LLVMGetNoWrapFlags(LLVMValueRef I)
+{
+  OverflowingBinaryOperator *O = dyn_cast<OverflowingBinaryOperator>(unwrap(I));
+  unsigned flags = 0;
+  if(!O)
+    return 0;
+  if(O->hasNoUnsignedWrap())
+    flags |= LLVMNoUnsignedWrap;
+  if(O->hasNoSignedWrap())
+    flags |= LLVMNoSignedWrap;
+  return flags;
+}
+
+unsigned LLVMGetFastMathFlags(LLVMValueRef I)
+{
+  FPMathOperator *O = dyn_cast<FPMathOperator>(unwrap(I));
+  FastMathFlags FMF;
+  unsigned flags = 0;
+  if(!O)
+    return 0;
+  FMF = O->getFastMathFlags();
+  if(FMF.allowReassoc())
+    flags |= LLVMFastMathAllowReassoc;
+  if(FMF.noNaNs())
+    flags |= LLVMFastMathNoNaNs;
+  if(FMF.noInfs())
+    flags |= LLVMFastMathNoInfs;
+  if(FMF.noSignedZeros())
+    flags |= LLVMFastMathNoSignedZeros;
+  if(FMF.allowReciprocal())
+    flags |= LLVMFastMathAllowReciprocal;
+  if(FMF.allowContract())
+    flags |= LLVMFastMathAllowContract;
+  if(FMF.approxFunc())
+    flags |= LLVMFastMathApproxFunctions;
+  return flags;
+}
@@ -0,0 +1,23 @@
+#ifndef IRFLAGS_H
+#define IRFLAGS_H
+#include "llvm-c/Core.h"
+#ifdef __cplusplus
+extern "C" {
+#endif
+//wrap flags of an add, sub, mul or shl, 0 for other values
+#define LLVMNoUnsignedWrap 1
+#define LLVMNoSignedWrap 2
+unsigned LLVMGetNoWrapFlags(LLVMValueRef I);
+//fast-math flags of a floating point operation, 0 for other values
+#define LLVMFastMathAllowReassoc 1
+#define LLVMFastMathNoNaNs 2
+#define LLVMFastMathNoInfs 4
+#define LLVMFastMathNoSignedZeros 8
+#define LLVMFastMathAllowReciprocal 16
+#define LLVMFastMathAllowContract 32
+#define LLVMFastMathApproxFunctions 64
+unsigned LLVMGetFastMathFlags(LLVMValueRef I);
+#ifdef __cplusplus
+}
+#endif
+#endif
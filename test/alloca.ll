@@ -0,0 +1,50 @@
+; Lanes that live in allocas of their own: the allocas become one vector
+; alloca, and the loads and stores through them full width accesses.
+; CHECK-LABEL: define i32 @main(
+; CHECK: alloca <4 x i32>
+; CHECK: load <4 x i32>
+; CHECK: add <4 x i32>
+; CHECK: mul <4 x i32>
+; CHECK: xor <4 x i32>
+; CHECK: store <4 x i32>
+
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define i32 @main() {
+entry:
+  %p0 = alloca i32
+  %p1 = alloca i32
+  %p2 = alloca i32
+  %p3 = alloca i32
+  store i32 3, i32* %p0
+  store i32 5, i32* %p1
+  store i32 7, i32* %p2
+  store i32 11, i32* %p3
+  %l0 = load i32, i32* %p0
+  %l1 = load i32, i32* %p1
+  %l2 = load i32, i32* %p2
+  %l3 = load i32, i32* %p3
+  %a0 = add i32 %l0, %l0
+  %a1 = add i32 %l1, %l1
+  %a2 = add i32 %l2, %l2
+  %a3 = add i32 %l3, %l3
+  %m0 = mul i32 %a0, %l0
+  %m1 = mul i32 %a1, %l1
+  %m2 = mul i32 %a2, %l2
+  %m3 = mul i32 %a3, %l3
+  %x0 = xor i32 %m0, %a0
+  %x1 = xor i32 %m1, %a1
+  %x2 = xor i32 %m2, %a2
+  %x3 = xor i32 %m3, %a3
+  store i32 %x0, i32* %p0
+  store i32 %x1, i32* %p1
+  store i32 %x2, i32* %p2
+  store i32 %x3, i32* %p3
+  %r0 = load i32, i32* %p0
+  %r3 = load i32, i32* %p3
+  %r = add i32 %r0, %r3
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %r)
+  ret i32 0
+}
@@ -0,0 +1,53 @@
+; Lanes that alternate add and sub become one vector add, one vector sub
+; and a shuffle that takes the even lanes from one and the odd from the other.
+; CHECK-LABEL: define void @alt(
+; CHECK: load <4 x i32>
+; CHECK-DAG: add <4 x i32>
+; CHECK-DAG: sub <4 x i32>
+; CHECK: %v.alt = shufflevector <4 x i32>
+; CHECK: store <4 x i32> %v.alt
+
+@B = global [4 x i32] [i32 7, i32 9, i32 11, i32 13]
+@C = global [4 x i32] [i32 1, i32 2, i32 3, i32 4]
+@D = global [4 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @alt() {
+entry:
+  %b0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 0)
+  %c0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 0)
+  %r0 = add i32 %b0, %c0
+  store i32 %r0, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 0)
+  %b1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 1)
+  %c1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 1)
+  %r1 = sub i32 %b1, %c1
+  store i32 %r1, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 1)
+  %b2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 2)
+  %c2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 2)
+  %r2 = add i32 %b2, %c2
+  store i32 %r2, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 2)
+  %b3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 3)
+  %c3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 3)
+  %r3 = sub i32 %b3, %c3
+  store i32 %r3, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 3)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @alt()
+  %d0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 0)
+  %d1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 1)
+  %d2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 2)
+  %d3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 3)
+  %m1 = mul i32 %d0, 1000
+  %m2 = mul i32 %d1, 100
+  %m3 = mul i32 %d2, 10
+  %s1 = add i32 %m1, %m2
+  %s2 = add i32 %s1, %m3
+  %s3 = add i32 %s2, %d3
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %s3)
+  ret i32 0
+}
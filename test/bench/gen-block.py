@@ -0,0 +1,18 @@
+#!/usr/bin/env python3
+# Prints one function with a single basic block of N independent
+# alloca/load/add/mul/xor/store chains, 6N+1 instructions in all.
+# The default of 1700 chains is the 10,201-instruction block the
+# compile-time numbers are measured on.
+import sys
+
+n = int(sys.argv[1]) if len(sys.argv) > 1 else 1700
+print("define void @big() {\nentry:")
+for i in range(n):
+    print(f"  %p{i} = alloca i32")
+for i in range(n):
+    print(f"  %l{i} = load i32, i32* %p{i}")
+    print(f"  %a{i} = add i32 %l{i}, %l{i}")
+    print(f"  %m{i} = mul i32 %a{i}, %l{i}")
+    print(f"  %x{i} = xor i32 %m{i}, %a{i}")
+    print(f"  store i32 %x{i}, i32* %p{i}")
+print("  ret void\n}")
@@ -0,0 +1,39 @@
+#!/usr/bin/env python3
+# Prints a module of N functions (default 120) for the allocation and
+# peak RSS numbers. Each function loads, adds a constant to, multiplies
+# and stores back 40, 80, 150 or 300 allocas in groups of eight, picked
+# with a fixed seed, then multiplies eight floats of @G by @H.
+import random
+import sys
+
+n = int(sys.argv[1]) if len(sys.argv) > 1 else 120
+rand = random.Random(9)
+print("@G = global [64 x float] zeroinitializer")
+print("@H = global [64 x float] zeroinitializer")
+for f in range(n):
+    size = rand.choice((40, 80, 150, 300))
+    print(f"define void @f{f}() {{\nentry:")
+    for i in range(size):
+        print(f"  %p{i} = alloca i32")
+    for base in range(0, size, 8):
+        group = range(base, min(base + 8, size))
+        for i in group:
+            print(f"  %l{i} = load i32, i32* %p{i}")
+        for i in group:
+            print(f"  %a{i} = add i32 %l{i}, {i % 7}")
+        for i in group:
+            print(f"  %m{i} = mul i32 %a{i}, %l{i}")
+        for i in group:
+            print(f"  store i32 %m{i}, i32* %p{i}")
+    for i in range(8):
+        print(f"  %g{i} = getelementptr [64 x float], [64 x float]* @G, i64 0, i64 {i}")
+        print(f"  %h{i} = getelementptr [64 x float], [64 x float]* @H, i64 0, i64 {i}")
+    for i in range(8):
+        print(f"  %x{i} = load float, float* %g{i}")
+    for i in range(8):
+        print(f"  %y{i} = load float, float* %h{i}")
+    for i in range(8):
+        print(f"  %z{i} = fmul float %x{i}, %y{i}")
+    for i in range(8):
+        print(f"  store float %z{i}, float* %g{i}")
+    print("  ret void\n}")
@@ -0,0 +1,37 @@
+#!/bin/sh
+# Times the pass on generated inputs. Takes the same SLP_DRIVER,
+# SLP_LIBDIR and LLVM_CONFIG as test/run.sh; the pass's own variables
+# (SLP_THREADS, SLP_STATS, ...) are passed through.
+#
+#   block [N]   one block of N chains (gen-block.py, default 1700)
+#   module [N]  a module of N functions (gen-module.py, default 120)
+#
+# The pass statistics end with the lists, pairs and valmaps handed out,
+# how many needed a malloc, and the peak RSS.
+
+BENCHDIR=$(cd "$(dirname "$0")" && pwd)
+LLVM_CONFIG=${LLVM_CONFIG:-llvm-config}
+OUT=$(mktemp -d "${TMPDIR:-/tmp}/slp-bench.XXXXXX")
+trap 'rm -rf "$OUT"' EXIT
+
+if [ -z "$SLP_DRIVER" ]; then
+	SLP_DRIVER=$OUT/slp-driver
+	${CC:-cc} $($LLVM_CONFIG --cflags) -o "$SLP_DRIVER" "$BENCHDIR/../slp-driver.c" \
+		-L"${SLP_LIBDIR:-.}" -lSLP $($LLVM_CONFIG --ldflags --libs --system-libs) || exit 1
+fi
+
+case "$1" in
+block)
+	python3 "$BENCHDIR/gen-block.py" ${2:-1700} > "$OUT/in.ll" ;;
+module)
+	python3 "$BENCHDIR/gen-module.py" ${2:-120} > "$OUT/in.ll" ;;
+*)
+	echo "usage: $0 block [chains] | module [functions]" >&2
+	exit 1 ;;
+esac
+
+echo "$(grep -c '^  ' "$OUT/in.ll") instructions"
+start=$(date +%s.%N)
+"$SLP_DRIVER" "$OUT/in.ll" "$OUT/out.ll" || exit 1
+end=$(date +%s.%N)
+awk -v s="$start" -v e="$end" 'BEGIN { printf "SLP took %.2f s\n", e - s }'
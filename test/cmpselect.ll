@@ -0,0 +1,145 @@
+; Compares and selects pack like arithmetic: a clamp of four ints becomes
+; vector icmps feeding vector selects, a float max a vector fcmp and select,
+; and a select on one scalar condition keeps that i1 for all lanes.
+; CHECK-LABEL: define void @clamp(
+; CHECK: [[C:%[0-9]+]] = icmp slt <4 x i32>
+; CHECK: select <4 x i1> [[C]], <4 x i32>
+; CHECK: icmp sgt <4 x i32>
+; CHECK: select <4 x i1>
+; CHECK: select i1 %flag, <4 x i32>
+; CHECK: store <4 x i32>
+; CHECK-LABEL: define void @fmax(
+; CHECK: [[F:%[0-9]+]] = fcmp ogt <4 x float>
+; CHECK: select <4 x i1> [[F]], <4 x float>
+; CHECK: store <4 x float>
+
+@A = global [8 x i32] [i32 -30, i32 -19, i32 -8, i32 3, i32 14, i32 25, i32 36, i32 47]
+@C = global [8 x i32] zeroinitializer
+@F = global [8 x float] [float -6.0, float -4.5, float -3.0, float -1.5, float 0.0, float 1.5, float 3.0, float 4.5]
+@G = global [8 x float] [float 1.0, float -5.0, float -2.0, float 0.0, float 1.0, float 2.0, float 3.5, float 4.0]
+@H = global [8 x float] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @clamp(i1 %flag) {
+entry:
+  %x0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %x1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %x2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %x3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %c0 = icmp slt i32 %x0, -10
+  %y0 = select i1 %c0, i32 -10, i32 %x0
+  %c1 = icmp slt i32 %x1, -10
+  %y1 = select i1 %c1, i32 -10, i32 %x1
+  %c2 = icmp slt i32 %x2, -10
+  %y2 = select i1 %c2, i32 -10, i32 %x2
+  %c3 = icmp slt i32 %x3, -10
+  %y3 = select i1 %c3, i32 -10, i32 %x3
+  %d0 = icmp sgt i32 %y0, 0
+  %z0 = select i1 %d0, i32 0, i32 %y0
+  %d1 = icmp sgt i32 %y1, 0
+  %z1 = select i1 %d1, i32 0, i32 %y1
+  %d2 = icmp sgt i32 %y2, 0
+  %z2 = select i1 %d2, i32 0, i32 %y2
+  %d3 = icmp sgt i32 %y3, 0
+  %z3 = select i1 %d3, i32 0, i32 %y3
+  %e0 = select i1 %flag, i32 %z0, i32 %x0
+  store i32 %e0, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %e1 = select i1 %flag, i32 %z1, i32 %x1
+  store i32 %e1, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %e2 = select i1 %flag, i32 %z2, i32 %x2
+  store i32 %e2, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %e3 = select i1 %flag, i32 %z3, i32 %x3
+  store i32 %e3, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  ret void
+}
+
+define void @fmax() {
+entry:
+  %f0 = load float, float* getelementptr ([8 x float], [8 x float]* @F, i64 0, i64 0)
+  %h0 = load float, float* getelementptr ([8 x float], [8 x float]* @G, i64 0, i64 0)
+  %p0 = fcmp ogt float %f0, %h0
+  %m0 = select i1 %p0, float %f0, float %h0
+  store float %m0, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 0)
+  %f1 = load float, float* getelementptr ([8 x float], [8 x float]* @F, i64 0, i64 1)
+  %h1 = load float, float* getelementptr ([8 x float], [8 x float]* @G, i64 0, i64 1)
+  %p1 = fcmp ogt float %f1, %h1
+  %m1 = select i1 %p1, float %f1, float %h1
+  store float %m1, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 1)
+  %f2 = load float, float* getelementptr ([8 x float], [8 x float]* @F, i64 0, i64 2)
+  %h2 = load float, float* getelementptr ([8 x float], [8 x float]* @G, i64 0, i64 2)
+  %p2 = fcmp ogt float %f2, %h2
+  %m2 = select i1 %p2, float %f2, float %h2
+  store float %m2, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 2)
+  %f3 = load float, float* getelementptr ([8 x float], [8 x float]* @F, i64 0, i64 3)
+  %h3 = load float, float* getelementptr ([8 x float], [8 x float]* @G, i64 0, i64 3)
+  %p3 = fcmp ogt float %f3, %h3
+  %m3 = select i1 %p3, float %f3, float %h3
+  store float %m3, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 3)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @clamp(i1 1)
+  call void @fmax()
+  %c0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %h0 = mul i32 0, 31
+  %e0 = add i32 %h0, %c0
+  %c1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %h1 = mul i32 %e0, 31
+  %e1 = add i32 %h1, %c1
+  %c2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %h2 = mul i32 %e1, 31
+  %e2 = add i32 %h2, %c2
+  %c3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  %h3 = mul i32 %e2, 31
+  %e3 = add i32 %h3, %c3
+  %c4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 4)
+  %h4 = mul i32 %e3, 31
+  %e4 = add i32 %h4, %c4
+  %c5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 5)
+  %h5 = mul i32 %e4, 31
+  %e5 = add i32 %h5, %c5
+  %c6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 6)
+  %h6 = mul i32 %e5, 31
+  %e6 = add i32 %h6, %c6
+  %c7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 7)
+  %h7 = mul i32 %e6, 31
+  %e7 = add i32 %h7, %c7
+  %c8 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 0)
+  %d8 = fptosi float %c8 to i32
+  %h8 = mul i32 %e7, 31
+  %e8 = add i32 %h8, %d8
+  %c9 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 1)
+  %d9 = fptosi float %c9 to i32
+  %h9 = mul i32 %e8, 31
+  %e9 = add i32 %h9, %d9
+  %c10 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 2)
+  %d10 = fptosi float %c10 to i32
+  %h10 = mul i32 %e9, 31
+  %e10 = add i32 %h10, %d10
+  %c11 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 3)
+  %d11 = fptosi float %c11 to i32
+  %h11 = mul i32 %e10, 31
+  %e11 = add i32 %h11, %d11
+  %c12 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 4)
+  %d12 = fptosi float %c12 to i32
+  %h12 = mul i32 %e11, 31
+  %e12 = add i32 %h12, %d12
+  %c13 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 5)
+  %d13 = fptosi float %c13 to i32
+  %h13 = mul i32 %e12, 31
+  %e13 = add i32 %h13, %d13
+  %c14 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 6)
+  %d14 = fptosi float %c14 to i32
+  %h14 = mul i32 %e13, 31
+  %e14 = add i32 %h14, %d14
+  %c15 = load float, float* getelementptr ([8 x float], [8 x float]* @H, i64 0, i64 7)
+  %d15 = fptosi float %c15 to i32
+  %h15 = mul i32 %e14, 31
+  %e15 = add i32 %h15, %d15
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %e15)
+  ret i32 0
+}
@@ -0,0 +1,51 @@
+; Four adjacent lanes from three arrays: the loads, the arithmetic and the
+; stores each become one <4 x i32> operation.
+; CHECK-LABEL: define void @k(
+; CHECK: load <4 x i32>, <4 x i32>* bitcast ([4 x i32]* @A
+; CHECK: load <4 x i32>, <4 x i32>* bitcast ([4 x i32]* @B
+; CHECK: add <4 x i32>
+; CHECK: mul <4 x i32>
+; CHECK: store <4 x i32> {{.*}} bitcast ([4 x i32]* @C
+; CHECK: ret void
+
+@A = global [4 x i32] [i32 1, i32 2, i32 3, i32 4]
+@B = global [4 x i32] [i32 10, i32 20, i32 30, i32 40]
+@C = global [4 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @k(i32 %s) {
+entry:
+  %a0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A, i64 0, i64 3)
+  %b0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 0)
+  %b1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 1)
+  %b2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 2)
+  %b3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B, i64 0, i64 3)
+  %s0 = add i32 %a0, %b0
+  %s1 = add i32 %a1, %b1
+  %s2 = add i32 %a2, %b2
+  %s3 = add i32 %a3, %b3
+  %m0 = mul i32 %s0, %s
+  %m1 = mul i32 %s1, %s
+  %m2 = mul i32 %s2, %s
+  %m3 = mul i32 %s3, %s
+  store i32 %m0, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 0)
+  store i32 %m1, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 1)
+  store i32 %m2, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 2)
+  store i32 %m3, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 3)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @k(i32 3)
+  %c0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 0)
+  %c3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @C, i64 0, i64 3)
+  %r = add i32 %c0, %c3
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %r)
+  ret i32 0
+}
@@ -0,0 +1,59 @@
+; An fadd lane whose fmul operand allows contraction fuses into one vector
+; llvm.fmuladd call when the target has fma (avx2).
+; ENV: SLP_TARGET=avx2
+; CHECK-LABEL: define void @fma(
+; CHECK: %v.fma = call <4 x float> @llvm.fmuladd.v4f32(<4 x float>
+; CHECK: store <4 x float> %v.fma
+; CHECK-NOT: fmul <4 x float>
+
+@A = global [4 x float] [float 1.5, float 2.0, float 2.5, float 3.0]
+@B = global [4 x float] [float 2.0, float 4.0, float 6.0, float 8.0]
+@C = global [4 x float] [float 0.5, float 1.0, float 1.5, float 2.0]
+@D = global [4 x float] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @fma() {
+entry:
+  %a0 = load float, float* getelementptr ([4 x float], [4 x float]* @A, i64 0, i64 0)
+  %b0 = load float, float* getelementptr ([4 x float], [4 x float]* @B, i64 0, i64 0)
+  %c0 = load float, float* getelementptr ([4 x float], [4 x float]* @C, i64 0, i64 0)
+  %m0 = fmul contract float %a0, %b0
+  %r0 = fadd contract float %m0, %c0
+  store float %r0, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 0)
+  %a1 = load float, float* getelementptr ([4 x float], [4 x float]* @A, i64 0, i64 1)
+  %b1 = load float, float* getelementptr ([4 x float], [4 x float]* @B, i64 0, i64 1)
+  %c1 = load float, float* getelementptr ([4 x float], [4 x float]* @C, i64 0, i64 1)
+  %m1 = fmul contract float %a1, %b1
+  %r1 = fadd contract float %m1, %c1
+  store float %r1, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 1)
+  %a2 = load float, float* getelementptr ([4 x float], [4 x float]* @A, i64 0, i64 2)
+  %b2 = load float, float* getelementptr ([4 x float], [4 x float]* @B, i64 0, i64 2)
+  %c2 = load float, float* getelementptr ([4 x float], [4 x float]* @C, i64 0, i64 2)
+  %m2 = fmul contract float %a2, %b2
+  %r2 = fadd contract float %m2, %c2
+  store float %r2, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 2)
+  %a3 = load float, float* getelementptr ([4 x float], [4 x float]* @A, i64 0, i64 3)
+  %b3 = load float, float* getelementptr ([4 x float], [4 x float]* @B, i64 0, i64 3)
+  %c3 = load float, float* getelementptr ([4 x float], [4 x float]* @C, i64 0, i64 3)
+  %m3 = fmul contract float %a3, %b3
+  %r3 = fadd contract float %m3, %c3
+  store float %r3, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 3)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @fma()
+  %d0 = load float, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 0)
+  %d1 = load float, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 1)
+  %d2 = load float, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 2)
+  %d3 = load float, float* getelementptr ([4 x float], [4 x float]* @D, i64 0, i64 3)
+  %s1 = fadd float %d0, %d1
+  %s2 = fadd float %s1, %d2
+  %s3 = fadd float %s2, %d3
+  %i = fptosi float %s3 to i32
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %i)
+  ret i32 0
+}
@@ -0,0 +1,115 @@
+; SLP_MAX_TREE_DEPTH bounds how far a tree grows below its seed. At depth one
+; @copy still packs its loads under the stores. @deep, which is vectorized
+; whole without the limit, stops at the adds, and gathering their operands
+; lane by lane costs more than the two packs save, so it stays scalar.
+; ENV: SLP_MAX_TREE_DEPTH=1
+; CHECK-LABEL: define void @copy(
+; CHECK: load <4 x i32>
+; CHECK: store <4 x i32>
+; CHECK-LABEL: define void @deep(
+; CHECK-NOT: <4 x i32>
+; CHECK: ret void
+
+@A = global [8 x i32] [i32 3, i32 1, i32 4, i32 1, i32 5, i32 9, i32 2, i32 6]
+@C = global [8 x i32] zeroinitializer
+@D = global [8 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @copy() {
+entry:
+  %x0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  store i32 %x0, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %x1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  store i32 %x1, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %x2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  store i32 %x2, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %x3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  store i32 %x3, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  ret void
+}
+define void @deep(i32 %a0, i32 %a1, i32 %a2, i32 %a3) {
+entry:
+  %m0 = mul i32 %a0, 3
+  %n0 = xor i32 %m0, 5
+  %o0 = add i32 %n0, 7
+  %p0 = shl i32 %o0, 1
+  %s0 = add i32 %p0, %a0
+  store i32 %s0, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %m1 = mul i32 %a1, 3
+  %n1 = xor i32 %m1, 5
+  %o1 = add i32 %n1, 7
+  %p1 = shl i32 %o1, 1
+  %s1 = add i32 %p1, %a1
+  store i32 %s1, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %m2 = mul i32 %a2, 3
+  %n2 = xor i32 %m2, 5
+  %o2 = add i32 %n2, 7
+  %p2 = shl i32 %o2, 1
+  %s2 = add i32 %p2, %a2
+  store i32 %s2, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %m3 = mul i32 %a3, 3
+  %n3 = xor i32 %m3, 5
+  %o3 = add i32 %n3, 7
+  %p3 = shl i32 %o3, 1
+  %s3 = add i32 %p3, %a3
+  store i32 %s3, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  ret void
+}
+define i32 @main() {
+entry:
+  call void @copy()
+  call void @deep(i32 3, i32 -1, i32 4, i32 100)
+  %c0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %h0 = mul i32 0, 31
+  %e0 = add i32 %h0, %c0
+  %c1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %h1 = mul i32 %e0, 31
+  %e1 = add i32 %h1, %c1
+  %c2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %h2 = mul i32 %e1, 31
+  %e2 = add i32 %h2, %c2
+  %c3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  %h3 = mul i32 %e2, 31
+  %e3 = add i32 %h3, %c3
+  %c4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 4)
+  %h4 = mul i32 %e3, 31
+  %e4 = add i32 %h4, %c4
+  %c5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 5)
+  %h5 = mul i32 %e4, 31
+  %e5 = add i32 %h5, %c5
+  %c6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 6)
+  %h6 = mul i32 %e5, 31
+  %e6 = add i32 %h6, %c6
+  %c7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 7)
+  %h7 = mul i32 %e6, 31
+  %e7 = add i32 %h7, %c7
+  %c8 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %h8 = mul i32 %e7, 31
+  %e8 = add i32 %h8, %c8
+  %c9 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %h9 = mul i32 %e8, 31
+  %e9 = add i32 %h9, %c9
+  %c10 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %h10 = mul i32 %e9, 31
+  %e10 = add i32 %h10, %c10
+  %c11 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  %h11 = mul i32 %e10, 31
+  %e11 = add i32 %h11, %c11
+  %c12 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 4)
+  %h12 = mul i32 %e11, 31
+  %e12 = add i32 %h12, %c12
+  %c13 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 5)
+  %h13 = mul i32 %e12, 31
+  %e13 = add i32 %h13, %c13
+  %c14 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 6)
+  %h14 = mul i32 %e13, 31
+  %e14 = add i32 %h14, %c14
+  %c15 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 7)
+  %h15 = mul i32 %e14, 31
+  %e15 = add i32 %h15, %c15
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %e15)
+  ret i32 0
+}
+
@@ -0,0 +1,188 @@
+; Calls of pure math functions pack into their vector forms: intrinsics into
+; the vector intrinsic, sqrtf into llvm.sqrt, and sin, which only has a
+; four lane form, into the vsin4 that math.tbl names once the fma pairs above
+; it widen. A call that writes memory stays scalar.
+; ENV: SLP_MATH_TABLE=%S/math.tbl
+; CHECK-LABEL: define void @math(
+; CHECK: call <4 x double> @llvm.fabs.v4f64(<4 x double>
+; CHECK: call <4 x double> @llvm.sqrt.v4f64(<4 x double>
+; CHECK: call <4 x double> @vsin4(<4 x double>
+; CHECK: call <4 x double> @llvm.fma.v4f64(<4 x double>
+; CHECK: call <4 x float> @llvm.sqrt.v4f32(<4 x float>
+; CHECK-LABEL: define void @impure(
+; CHECK-COUNT-4: call double @side(double
+; CHECK-NOT: <4 x double>
+; CHECK: ret void
+
+declare double @llvm.sqrt.f64(double)
+declare double @llvm.fabs.f64(double)
+declare double @llvm.fma.f64(double, double, double)
+declare float @sqrtf(float) readnone nounwind
+declare double @sin(double) readnone nounwind
+
+@cnt = global i32 0
+
+define double @side(double %x) {
+  %c = load i32, i32* @cnt
+  %d = add i32 %c, 1
+  store i32 %d, i32* @cnt
+  ret double %x
+}
+
+define <4 x double> @vsin4(<4 x double> %v) {
+  %e0 = extractelement <4 x double> %v, i32 0
+  %s0 = call double @sin(double %e0)
+  %e1 = extractelement <4 x double> %v, i32 1
+  %s1 = call double @sin(double %e1)
+  %e2 = extractelement <4 x double> %v, i32 2
+  %s2 = call double @sin(double %e2)
+  %e3 = extractelement <4 x double> %v, i32 3
+  %s3 = call double @sin(double %e3)
+  %r0 = insertelement <4 x double> undef, double %s0, i32 0
+  %r1 = insertelement <4 x double> %r0, double %s1, i32 1
+  %r2 = insertelement <4 x double> %r1, double %s2, i32 2
+  %r3 = insertelement <4 x double> %r2, double %s3, i32 3
+  ret <4 x double> %r3
+}
+
+@F = global [8 x double] [double -4.0, double -2.75, double -1.5, double -0.25, double 1.0, double 2.25, double 3.5, double 4.75]
+@G = global [8 x double] zeroinitializer
+@P = global [8 x float] [float 1.0, float 3.5, float 6.0, float 8.5, float 11.0, float 13.5, float 16.0, float 18.5]
+@Q = global [8 x float] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @math() {
+entry:
+  %x0 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 0)
+  %a0 = call double @llvm.fabs.f64(double %x0)
+  %q0 = call double @llvm.sqrt.f64(double %a0)
+  %s0 = call double @sin(double %q0)
+  %m0 = call double @llvm.fma.f64(double %s0, double %x0, double 1.5)
+  store double %m0, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 0)
+  %x1 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 1)
+  %a1 = call double @llvm.fabs.f64(double %x1)
+  %q1 = call double @llvm.sqrt.f64(double %a1)
+  %s1 = call double @sin(double %q1)
+  %m1 = call double @llvm.fma.f64(double %s1, double %x1, double 1.5)
+  store double %m1, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 1)
+  %x2 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 2)
+  %a2 = call double @llvm.fabs.f64(double %x2)
+  %q2 = call double @llvm.sqrt.f64(double %a2)
+  %s2 = call double @sin(double %q2)
+  %m2 = call double @llvm.fma.f64(double %s2, double %x2, double 1.5)
+  store double %m2, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 2)
+  %x3 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 3)
+  %a3 = call double @llvm.fabs.f64(double %x3)
+  %q3 = call double @llvm.sqrt.f64(double %a3)
+  %s3 = call double @sin(double %q3)
+  %m3 = call double @llvm.fma.f64(double %s3, double %x3, double 1.5)
+  store double %m3, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 3)
+  %p0 = load float, float* getelementptr ([8 x float], [8 x float]* @P, i64 0, i64 0)
+  %r0 = call float @sqrtf(float %p0)
+  store float %r0, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 0)
+  %p1 = load float, float* getelementptr ([8 x float], [8 x float]* @P, i64 0, i64 1)
+  %r1 = call float @sqrtf(float %p1)
+  store float %r1, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 1)
+  %p2 = load float, float* getelementptr ([8 x float], [8 x float]* @P, i64 0, i64 2)
+  %r2 = call float @sqrtf(float %p2)
+  store float %r2, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 2)
+  %p3 = load float, float* getelementptr ([8 x float], [8 x float]* @P, i64 0, i64 3)
+  %r3 = call float @sqrtf(float %p3)
+  store float %r3, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 3)
+  ret void
+}
+
+define void @impure() {
+entry:
+  %x4 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 4)
+  %z4 = call double @side(double %x4)
+  %w4 = fadd double %z4, 2.0
+  store double %w4, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 4)
+  %x5 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 5)
+  %z5 = call double @side(double %x5)
+  %w5 = fadd double %z5, 2.0
+  store double %w5, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 5)
+  %x6 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 6)
+  %z6 = call double @side(double %x6)
+  %w6 = fadd double %z6, 2.0
+  store double %w6, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 6)
+  %x7 = load double, double* getelementptr ([8 x double], [8 x double]* @F, i64 0, i64 7)
+  %z7 = call double @side(double %x7)
+  %w7 = fadd double %z7, 2.0
+  store double %w7, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 7)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @math()
+  call void @impure()
+  %c0 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 0)
+  %d0 = fptosi double %c0 to i32
+  %h0 = mul i32 0, 31
+  %e0 = add i32 %h0, %d0
+  %c1 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 1)
+  %d1 = fptosi double %c1 to i32
+  %h1 = mul i32 %e0, 31
+  %e1 = add i32 %h1, %d1
+  %c2 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 2)
+  %d2 = fptosi double %c2 to i32
+  %h2 = mul i32 %e1, 31
+  %e2 = add i32 %h2, %d2
+  %c3 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 3)
+  %d3 = fptosi double %c3 to i32
+  %h3 = mul i32 %e2, 31
+  %e3 = add i32 %h3, %d3
+  %c4 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 4)
+  %d4 = fptosi double %c4 to i32
+  %h4 = mul i32 %e3, 31
+  %e4 = add i32 %h4, %d4
+  %c5 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 5)
+  %d5 = fptosi double %c5 to i32
+  %h5 = mul i32 %e4, 31
+  %e5 = add i32 %h5, %d5
+  %c6 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 6)
+  %d6 = fptosi double %c6 to i32
+  %h6 = mul i32 %e5, 31
+  %e6 = add i32 %h6, %d6
+  %c7 = load double, double* getelementptr ([8 x double], [8 x double]* @G, i64 0, i64 7)
+  %d7 = fptosi double %c7 to i32
+  %h7 = mul i32 %e6, 31
+  %e7 = add i32 %h7, %d7
+  %c8 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 0)
+  %d8 = fptosi float %c8 to i32
+  %h8 = mul i32 %e7, 31
+  %e8 = add i32 %h8, %d8
+  %c9 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 1)
+  %d9 = fptosi float %c9 to i32
+  %h9 = mul i32 %e8, 31
+  %e9 = add i32 %h9, %d9
+  %c10 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 2)
+  %d10 = fptosi float %c10 to i32
+  %h10 = mul i32 %e9, 31
+  %e10 = add i32 %h10, %d10
+  %c11 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 3)
+  %d11 = fptosi float %c11 to i32
+  %h11 = mul i32 %e10, 31
+  %e11 = add i32 %h11, %d11
+  %c12 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 4)
+  %d12 = fptosi float %c12 to i32
+  %h12 = mul i32 %e11, 31
+  %e12 = add i32 %h12, %d12
+  %c13 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 5)
+  %d13 = fptosi float %c13 to i32
+  %h13 = mul i32 %e12, 31
+  %e13 = add i32 %h13, %d13
+  %c14 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 6)
+  %d14 = fptosi float %c14 to i32
+  %h14 = mul i32 %e13, 31
+  %e14 = add i32 %h14, %d14
+  %c15 = load float, float* getelementptr ([8 x float], [8 x float]* @Q, i64 0, i64 7)
+  %d15 = fptosi float %c15 to i32
+  %h15 = mul i32 %e14, 31
+  %e15 = add i32 %h15, %d15
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %e15)
+  ret i32 0
+}
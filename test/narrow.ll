@@ -0,0 +1,236 @@
+; i8 lanes widened to i32, added and truncated back: only the low byte
+; survives the trunc, so the adds run on i8 lanes, 16 to a register.
+; CHECK-LABEL: define void @k(
+; CHECK: load <16 x i8>
+; CHECK-NOT: zext
+; CHECK: add <16 x i8>
+; CHECK-NOT: trunc
+; CHECK: store <16 x i8>
+
+@A = global [16 x i8] zeroinitializer
+@B = global [16 x i8] zeroinitializer
+@C = global [16 x i8] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @k() {
+entry:
+  %x0 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 0)
+  %y0 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 0)
+  %x1 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 1)
+  %y1 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 1)
+  %x2 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 2)
+  %y2 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 2)
+  %x3 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 3)
+  %y3 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 3)
+  %x4 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 4)
+  %y4 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 4)
+  %x5 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 5)
+  %y5 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 5)
+  %x6 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 6)
+  %y6 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 6)
+  %x7 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 7)
+  %y7 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 7)
+  %x8 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 8)
+  %y8 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 8)
+  %x9 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 9)
+  %y9 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 9)
+  %x10 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 10)
+  %y10 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 10)
+  %x11 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 11)
+  %y11 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 11)
+  %x12 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 12)
+  %y12 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 12)
+  %x13 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 13)
+  %y13 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 13)
+  %x14 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 14)
+  %y14 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 14)
+  %x15 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 15)
+  %y15 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 15)
+  %xw0 = zext i8 %x0 to i32
+  %yw0 = zext i8 %y0 to i32
+  %xw1 = zext i8 %x1 to i32
+  %yw1 = zext i8 %y1 to i32
+  %xw2 = zext i8 %x2 to i32
+  %yw2 = zext i8 %y2 to i32
+  %xw3 = zext i8 %x3 to i32
+  %yw3 = zext i8 %y3 to i32
+  %xw4 = zext i8 %x4 to i32
+  %yw4 = zext i8 %y4 to i32
+  %xw5 = zext i8 %x5 to i32
+  %yw5 = zext i8 %y5 to i32
+  %xw6 = zext i8 %x6 to i32
+  %yw6 = zext i8 %y6 to i32
+  %xw7 = zext i8 %x7 to i32
+  %yw7 = zext i8 %y7 to i32
+  %xw8 = zext i8 %x8 to i32
+  %yw8 = zext i8 %y8 to i32
+  %xw9 = zext i8 %x9 to i32
+  %yw9 = zext i8 %y9 to i32
+  %xw10 = zext i8 %x10 to i32
+  %yw10 = zext i8 %y10 to i32
+  %xw11 = zext i8 %x11 to i32
+  %yw11 = zext i8 %y11 to i32
+  %xw12 = zext i8 %x12 to i32
+  %yw12 = zext i8 %y12 to i32
+  %xw13 = zext i8 %x13 to i32
+  %yw13 = zext i8 %y13 to i32
+  %xw14 = zext i8 %x14 to i32
+  %yw14 = zext i8 %y14 to i32
+  %xw15 = zext i8 %x15 to i32
+  %yw15 = zext i8 %y15 to i32
+  %s0 = add i32 %xw0, %yw0
+  %s1 = add i32 %xw1, %yw1
+  %s2 = add i32 %xw2, %yw2
+  %s3 = add i32 %xw3, %yw3
+  %s4 = add i32 %xw4, %yw4
+  %s5 = add i32 %xw5, %yw5
+  %s6 = add i32 %xw6, %yw6
+  %s7 = add i32 %xw7, %yw7
+  %s8 = add i32 %xw8, %yw8
+  %s9 = add i32 %xw9, %yw9
+  %s10 = add i32 %xw10, %yw10
+  %s11 = add i32 %xw11, %yw11
+  %s12 = add i32 %xw12, %yw12
+  %s13 = add i32 %xw13, %yw13
+  %s14 = add i32 %xw14, %yw14
+  %s15 = add i32 %xw15, %yw15
+  %t0 = trunc i32 %s0 to i8
+  store i8 %t0, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 0)
+  %t1 = trunc i32 %s1 to i8
+  store i8 %t1, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 1)
+  %t2 = trunc i32 %s2 to i8
+  store i8 %t2, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 2)
+  %t3 = trunc i32 %s3 to i8
+  store i8 %t3, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 3)
+  %t4 = trunc i32 %s4 to i8
+  store i8 %t4, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 4)
+  %t5 = trunc i32 %s5 to i8
+  store i8 %t5, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 5)
+  %t6 = trunc i32 %s6 to i8
+  store i8 %t6, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 6)
+  %t7 = trunc i32 %s7 to i8
+  store i8 %t7, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 7)
+  %t8 = trunc i32 %s8 to i8
+  store i8 %t8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 8)
+  %t9 = trunc i32 %s9 to i8
+  store i8 %t9, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 9)
+  %t10 = trunc i32 %s10 to i8
+  store i8 %t10, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 10)
+  %t11 = trunc i32 %s11 to i8
+  store i8 %t11, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 11)
+  %t12 = trunc i32 %s12 to i8
+  store i8 %t12, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 12)
+  %t13 = trunc i32 %s13 to i8
+  store i8 %t13, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 13)
+  %t14 = trunc i32 %s14 to i8
+  store i8 %t14, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 14)
+  %t15 = trunc i32 %s15 to i8
+  store i8 %t15, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 15)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  store i8 72, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 0)
+  store i8 -115, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 0)
+  store i8 109, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 1)
+  store i8 -24, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 1)
+  store i8 -110, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 2)
+  store i8 67, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 2)
+  store i8 -73, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 3)
+  store i8 -98, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 3)
+  store i8 -36, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 4)
+  store i8 -7, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 4)
+  store i8 1, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 5)
+  store i8 84, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 5)
+  store i8 38, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 6)
+  store i8 -81, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 6)
+  store i8 75, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 7)
+  store i8 10, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 7)
+  store i8 112, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 8)
+  store i8 101, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 8)
+  store i8 -107, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 9)
+  store i8 -64, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 9)
+  store i8 -70, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 10)
+  store i8 27, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 10)
+  store i8 -33, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 11)
+  store i8 118, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 11)
+  store i8 4, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 12)
+  store i8 -47, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 12)
+  store i8 41, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 13)
+  store i8 44, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 13)
+  store i8 78, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 14)
+  store i8 -121, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 14)
+  store i8 115, i8* getelementptr ([16 x i8], [16 x i8]* @A, i64 0, i64 15)
+  store i8 -30, i8* getelementptr ([16 x i8], [16 x i8]* @B, i64 0, i64 15)
+  call void @k()
+  %acc0 = add i32 0, 0
+  %c0 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 0)
+  %cw0 = zext i8 %c0 to i32
+  %u0 = mul i32 %acc0, 31
+  %acc1 = add i32 %u0, %cw0
+  %c1 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 1)
+  %cw1 = zext i8 %c1 to i32
+  %u1 = mul i32 %acc1, 31
+  %acc2 = add i32 %u1, %cw1
+  %c2 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 2)
+  %cw2 = zext i8 %c2 to i32
+  %u2 = mul i32 %acc2, 31
+  %acc3 = add i32 %u2, %cw2
+  %c3 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 3)
+  %cw3 = zext i8 %c3 to i32
+  %u3 = mul i32 %acc3, 31
+  %acc4 = add i32 %u3, %cw3
+  %c4 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 4)
+  %cw4 = zext i8 %c4 to i32
+  %u4 = mul i32 %acc4, 31
+  %acc5 = add i32 %u4, %cw4
+  %c5 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 5)
+  %cw5 = zext i8 %c5 to i32
+  %u5 = mul i32 %acc5, 31
+  %acc6 = add i32 %u5, %cw5
+  %c6 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 6)
+  %cw6 = zext i8 %c6 to i32
+  %u6 = mul i32 %acc6, 31
+  %acc7 = add i32 %u6, %cw6
+  %c7 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 7)
+  %cw7 = zext i8 %c7 to i32
+  %u7 = mul i32 %acc7, 31
+  %acc8 = add i32 %u7, %cw7
+  %c8 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 8)
+  %cw8 = zext i8 %c8 to i32
+  %u8 = mul i32 %acc8, 31
+  %acc9 = add i32 %u8, %cw8
+  %c9 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 9)
+  %cw9 = zext i8 %c9 to i32
+  %u9 = mul i32 %acc9, 31
+  %acc10 = add i32 %u9, %cw9
+  %c10 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 10)
+  %cw10 = zext i8 %c10 to i32
+  %u10 = mul i32 %acc10, 31
+  %acc11 = add i32 %u10, %cw10
+  %c11 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 11)
+  %cw11 = zext i8 %c11 to i32
+  %u11 = mul i32 %acc11, 31
+  %acc12 = add i32 %u11, %cw11
+  %c12 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 12)
+  %cw12 = zext i8 %c12 to i32
+  %u12 = mul i32 %acc12, 31
+  %acc13 = add i32 %u12, %cw12
+  %c13 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 13)
+  %cw13 = zext i8 %c13 to i32
+  %u13 = mul i32 %acc13, 31
+  %acc14 = add i32 %u13, %cw13
+  %c14 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 14)
+  %cw14 = zext i8 %c14 to i32
+  %u14 = mul i32 %acc14, 31
+  %acc15 = add i32 %u14, %cw14
+  %c15 = load i8, i8* getelementptr ([16 x i8], [16 x i8]* @C, i64 0, i64 15)
+  %cw15 = zext i8 %c15 to i32
+  %u15 = mul i32 %acc15, 31
+  %acc16 = add i32 %u15, %cw15
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %acc16)
+  ret i32 0
+}
@@ -0,0 +1,162 @@
+; Constants and arguments are operands too: lanes adding different constants
+; read a constant vector, lanes that share an argument read one splat, and
+; the swapped operands of a commutative lane are put back in order.
+; CHECK-LABEL: define void @consts(
+; CHECK: add <4 x i32> %{{[0-9]+}}, <i32 1, i32 2, i32 3, i32 4>
+; CHECK-LABEL: define void @splat(
+; CHECK: %v.splat = shufflevector <4 x i32>
+; CHECK: mul <4 x i32> %{{[0-9]+}}, %v.splat
+; CHECK-LABEL: define void @swapped(
+; CHECK: [[A:%[0-9]+]] = load <4 x i32>, {{.*}} @A
+; CHECK: [[B:%[0-9]+]] = load <4 x i32>, {{.*}} @B
+; CHECK: [[M:%[0-9]+]] = mul <4 x i32> [[A]], [[B]]
+; CHECK: sub <4 x i32> [[M]], [[A]]
+
+@A = global [8 x i32] [i32 3, i32 1, i32 4, i32 1, i32 5, i32 9, i32 2, i32 6]
+@B = global [8 x i32] [i32 2, i32 7, i32 1, i32 8, i32 2, i32 8, i32 1, i32 8]
+@C = global [8 x i32] zeroinitializer
+@D = global [8 x i32] zeroinitializer
+@E = global [8 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @consts() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %r0 = add i32 %a0, 1
+  store i32 %r0, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %r1 = add i32 %a1, 2
+  store i32 %r1, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %r2 = add i32 %a2, 3
+  store i32 %r2, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %r3 = add i32 %a3, 4
+  store i32 %r3, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  ret void
+}
+
+define void @splat(i32 %s) {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %r0 = mul i32 %a0, %s
+  store i32 %r0, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %r1 = mul i32 %a1, %s
+  store i32 %r1, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %r2 = mul i32 %a2, %s
+  store i32 %r2, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %r3 = mul i32 %a3, %s
+  store i32 %r3, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  ret void
+}
+
+define void @swapped() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 0)
+  %m0 = mul i32 %a0, %b0
+  %r0 = sub i32 %m0, %a0
+  store i32 %r0, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 1)
+  %m1 = mul i32 %b1, %a1
+  %r1 = sub i32 %m1, %a1
+  store i32 %r1, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 2)
+  %m2 = mul i32 %a2, %b2
+  %r2 = sub i32 %m2, %a2
+  store i32 %r2, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 3)
+  %m3 = mul i32 %b3, %a3
+  %r3 = sub i32 %m3, %a3
+  store i32 %r3, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 3)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @consts()
+  call void @splat(i32 7)
+  call void @swapped()
+  %c0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %h0 = mul i32 0, 31
+  %e0 = add i32 %h0, %c0
+  %c1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %h1 = mul i32 %e0, 31
+  %e1 = add i32 %h1, %c1
+  %c2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %h2 = mul i32 %e1, 31
+  %e2 = add i32 %h2, %c2
+  %c3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  %h3 = mul i32 %e2, 31
+  %e3 = add i32 %h3, %c3
+  %c4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 4)
+  %h4 = mul i32 %e3, 31
+  %e4 = add i32 %h4, %c4
+  %c5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 5)
+  %h5 = mul i32 %e4, 31
+  %e5 = add i32 %h5, %c5
+  %c6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 6)
+  %h6 = mul i32 %e5, 31
+  %e6 = add i32 %h6, %c6
+  %c7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 7)
+  %h7 = mul i32 %e6, 31
+  %e7 = add i32 %h7, %c7
+  %c8 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %h8 = mul i32 %e7, 31
+  %e8 = add i32 %h8, %c8
+  %c9 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %h9 = mul i32 %e8, 31
+  %e9 = add i32 %h9, %c9
+  %c10 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %h10 = mul i32 %e9, 31
+  %e10 = add i32 %h10, %c10
+  %c11 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  %h11 = mul i32 %e10, 31
+  %e11 = add i32 %h11, %c11
+  %c12 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 4)
+  %h12 = mul i32 %e11, 31
+  %e12 = add i32 %h12, %c12
+  %c13 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 5)
+  %h13 = mul i32 %e12, 31
+  %e13 = add i32 %h13, %c13
+  %c14 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 6)
+  %h14 = mul i32 %e13, 31
+  %e14 = add i32 %h14, %c14
+  %c15 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 7)
+  %h15 = mul i32 %e14, 31
+  %e15 = add i32 %h15, %c15
+  %c16 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 0)
+  %h16 = mul i32 %e15, 31
+  %e16 = add i32 %h16, %c16
+  %c17 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 1)
+  %h17 = mul i32 %e16, 31
+  %e17 = add i32 %h17, %c17
+  %c18 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 2)
+  %h18 = mul i32 %e17, 31
+  %e18 = add i32 %h18, %c18
+  %c19 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 3)
+  %h19 = mul i32 %e18, 31
+  %e19 = add i32 %h19, %c19
+  %c20 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 4)
+  %h20 = mul i32 %e19, 31
+  %e20 = add i32 %h20, %c20
+  %c21 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 5)
+  %h21 = mul i32 %e20, 31
+  %e21 = add i32 %h21, %c21
+  %c22 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 6)
+  %h22 = mul i32 %e21, 31
+  %e22 = add i32 %h22, %c22
+  %c23 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @E, i64 0, i64 7)
+  %h23 = mul i32 %e22, 31
+  %e23 = add i32 %h23, %c23
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %e23)
+  ret i32 0
+}
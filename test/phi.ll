@@ -0,0 +1,130 @@
+; Accumulators carried around the back edge of a one block loop become one
+; vector PHI, and the block after the loop reads its lanes back with
+; extractelement. The PHIs of @join merge two branches rather than close a
+; loop, so they stay scalar.
+; CHECK-LABEL: define double @fsum(
+; CHECK: loop:
+; CHECK: %v.phi = phi <4 x double>
+; CHECK: fmul <4 x double>
+; CHECK: fadd <4 x double> %v.phi
+; CHECK: exit:
+; CHECK: extractelement <4 x double>
+; CHECK-LABEL: define void @join(
+; CHECK: merge:
+; CHECK-NOT: phi <4 x
+; CHECK: ret void
+
+@A = global [64 x double] zeroinitializer
+@H = global [4 x double] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define double @fsum(i64 %n) {
+entry:
+  br label %loop
+loop:
+  %i = phi i64 [0, %entry], [%i.next, %loop]
+  %s0 = phi double [0.5, %entry], [%t0, %loop]
+  %s1 = phi double [1.5, %entry], [%t1, %loop]
+  %s2 = phi double [2.5, %entry], [%t2, %loop]
+  %s3 = phi double [3.5, %entry], [%t3, %loop]
+  %j0 = add i64 %i, 0
+  %p0 = getelementptr [64 x double], [64 x double]* @A, i64 0, i64 %j0
+  %x0 = load double, double* %p0
+  %m0 = fmul double %x0, %x0
+  %t0 = fadd double %s0, %m0
+  %j1 = add i64 %i, 1
+  %p1 = getelementptr [64 x double], [64 x double]* @A, i64 0, i64 %j1
+  %x1 = load double, double* %p1
+  %m1 = fmul double %x1, %x1
+  %t1 = fadd double %s1, %m1
+  %j2 = add i64 %i, 2
+  %p2 = getelementptr [64 x double], [64 x double]* @A, i64 0, i64 %j2
+  %x2 = load double, double* %p2
+  %m2 = fmul double %x2, %x2
+  %t2 = fadd double %s2, %m2
+  %j3 = add i64 %i, 3
+  %p3 = getelementptr [64 x double], [64 x double]* @A, i64 0, i64 %j3
+  %x3 = load double, double* %p3
+  %m3 = fmul double %x3, %x3
+  %t3 = fadd double %s3, %m3
+  %i.next = add i64 %i, 4
+  %c = icmp slt i64 %i.next, %n
+  br i1 %c, label %loop, label %exit
+exit:
+  %r0 = fadd double %t0, %t1
+  %r1 = fadd double %t2, %t3
+  %r = fadd double %r0, %r1
+  ret double %r
+}
+define void @join(i1 %flag) {
+entry:
+  br i1 %flag, label %then, label %else
+then:
+  %a0 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 0)
+  %a1 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 1)
+  %a2 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 2)
+  %a3 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 3)
+  br label %merge
+else:
+  %b0 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 8)
+  %b1 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 9)
+  %b2 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 10)
+  %b3 = load double, double* getelementptr ([64 x double], [64 x double]* @A, i64 0, i64 11)
+  br label %merge
+merge:
+  %s0 = phi double [%a0, %then], [%b0, %else]
+  %s1 = phi double [%a1, %then], [%b1, %else]
+  %s2 = phi double [%a2, %then], [%b2, %else]
+  %s3 = phi double [%a3, %then], [%b3, %else]
+  %t0 = fmul double %s0, %s0
+  store double %t0, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 0)
+  %t1 = fmul double %s1, %s1
+  store double %t1, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 1)
+  %t2 = fmul double %s2, %s2
+  store double %t2, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 2)
+  %t3 = fmul double %s3, %s3
+  store double %t3, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 3)
+  ret void
+}
+define i32 @main() {
+entry:
+  br label %init
+init:
+  %i = phi i64 [0, %entry], [%i1, %init]
+  %fi = sitofp i64 %i to double
+  %fv = fmul double %fi, 0.25
+  %pa = getelementptr [64 x double], [64 x double]* @A, i64 0, i64 %i
+  store double %fv, double* %pa
+  %i1 = add i64 %i, 1
+  %c = icmp slt i64 %i1, 64
+  br i1 %c, label %init, label %go
+go:
+  %f = call double @fsum(i64 64)
+  %fm = fmul double %f, 10.0
+  %acc0 = fptosi double %fm to i32
+  call void @join(i1 0)
+  %h0 = load double, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 0)
+  %hm0 = fmul double %h0, 100.0
+  %hi0 = fptosi double %hm0 to i32
+  %u0 = mul i32 %acc0, 31
+  %acc1 = add i32 %u0, %hi0
+  %h1 = load double, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 1)
+  %hm1 = fmul double %h1, 100.0
+  %hi1 = fptosi double %hm1 to i32
+  %u1 = mul i32 %acc1, 31
+  %acc2 = add i32 %u1, %hi1
+  %h2 = load double, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 2)
+  %hm2 = fmul double %h2, 100.0
+  %hi2 = fptosi double %hm2 to i32
+  %u2 = mul i32 %acc2, 31
+  %acc3 = add i32 %u2, %hi2
+  %h3 = load double, double* getelementptr ([4 x double], [4 x double]* @H, i64 0, i64 3)
+  %hm3 = fmul double %h3, 100.0
+  %hi3 = fptosi double %hm3 to i32
+  %u3 = mul i32 %acc3, 31
+  %acc4 = add i32 %u3, %hi3
+  %pf = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %pf, i32 %acc4)
+  ret i32 0
+}
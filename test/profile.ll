@@ -0,0 +1,145 @@
+; With SLP_BLOCK_PROFILE the blocks of a function are ranked by their
+; counts: the hot block is vectorized, the cold one, which never ran, is
+; skipped, and the entry block, which the profile does not list, is weighed
+; by loop depth as without a profile and vectorized too.
+; ENV: SLP_BLOCK_PROFILE=%S/profile.txt
+; CHECK-LABEL: define void @blocks(
+; CHECK: entry:
+; CHECK: add <4 x i32>
+; CHECK: hot:
+; CHECK: add <4 x i32>
+; CHECK: cold:
+; CHECK-NOT: <4 x i32>
+; CHECK: ret void
+
+@A = global [8 x i32] [i32 3, i32 1, i32 4, i32 1, i32 5, i32 9, i32 2, i32 6]
+@B = global [8 x i32] zeroinitializer
+@C = global [8 x i32] zeroinitializer
+@D = global [8 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @blocks(i1 %flag) {
+entry:
+  %Bx0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %By0 = add i32 %Bx0, 1
+  store i32 %By0, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 0)
+  %Bx1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %By1 = add i32 %Bx1, 1
+  store i32 %By1, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 1)
+  %Bx2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %By2 = add i32 %Bx2, 1
+  store i32 %By2, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 2)
+  %Bx3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %By3 = add i32 %Bx3, 1
+  store i32 %By3, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 3)
+  br i1 %flag, label %hot, label %cold
+hot:
+  %Cx0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %Cy0 = add i32 %Cx0, 2
+  store i32 %Cy0, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %Cx1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %Cy1 = add i32 %Cx1, 2
+  store i32 %Cy1, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %Cx2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %Cy2 = add i32 %Cx2, 2
+  store i32 %Cy2, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %Cx3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %Cy3 = add i32 %Cx3, 2
+  store i32 %Cy3, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  br label %cold
+cold:
+  %Dx0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %Dy0 = add i32 %Dx0, 3
+  store i32 %Dy0, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %Dx1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %Dy1 = add i32 %Dx1, 3
+  store i32 %Dy1, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %Dx2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %Dy2 = add i32 %Dx2, 3
+  store i32 %Dy2, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %Dx3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %Dy3 = add i32 %Dx3, 3
+  store i32 %Dy3, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  ret void
+}
+define i32 @main() {
+entry:
+  call void @blocks(i1 1)
+  %c0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 0)
+  %h0 = mul i32 0, 31
+  %e0 = add i32 %h0, %c0
+  %c1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 1)
+  %h1 = mul i32 %e0, 31
+  %e1 = add i32 %h1, %c1
+  %c2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 2)
+  %h2 = mul i32 %e1, 31
+  %e2 = add i32 %h2, %c2
+  %c3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 3)
+  %h3 = mul i32 %e2, 31
+  %e3 = add i32 %h3, %c3
+  %c4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 4)
+  %h4 = mul i32 %e3, 31
+  %e4 = add i32 %h4, %c4
+  %c5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 5)
+  %h5 = mul i32 %e4, 31
+  %e5 = add i32 %h5, %c5
+  %c6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 6)
+  %h6 = mul i32 %e5, 31
+  %e6 = add i32 %h6, %c6
+  %c7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 7)
+  %h7 = mul i32 %e6, 31
+  %e7 = add i32 %h7, %c7
+  %c8 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %h8 = mul i32 %e7, 31
+  %e8 = add i32 %h8, %c8
+  %c9 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %h9 = mul i32 %e8, 31
+  %e9 = add i32 %h9, %c9
+  %c10 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %h10 = mul i32 %e9, 31
+  %e10 = add i32 %h10, %c10
+  %c11 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  %h11 = mul i32 %e10, 31
+  %e11 = add i32 %h11, %c11
+  %c12 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 4)
+  %h12 = mul i32 %e11, 31
+  %e12 = add i32 %h12, %c12
+  %c13 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 5)
+  %h13 = mul i32 %e12, 31
+  %e13 = add i32 %h13, %c13
+  %c14 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 6)
+  %h14 = mul i32 %e13, 31
+  %e14 = add i32 %h14, %c14
+  %c15 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 7)
+  %h15 = mul i32 %e14, 31
+  %e15 = add i32 %h15, %c15
+  %c16 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %h16 = mul i32 %e15, 31
+  %e16 = add i32 %h16, %c16
+  %c17 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %h17 = mul i32 %e16, 31
+  %e17 = add i32 %h17, %c17
+  %c18 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %h18 = mul i32 %e17, 31
+  %e18 = add i32 %h18, %c18
+  %c19 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  %h19 = mul i32 %e18, 31
+  %e19 = add i32 %h19, %c19
+  %c20 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 4)
+  %h20 = mul i32 %e19, 31
+  %e20 = add i32 %h20, %c20
+  %c21 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 5)
+  %h21 = mul i32 %e20, 31
+  %e21 = add i32 %h21, %c21
+  %c22 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 6)
+  %h22 = mul i32 %e21, 31
+  %e22 = add i32 %h22, %c22
+  %c23 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 7)
+  %h23 = mul i32 %e22, 31
+  %e23 = add i32 %h23, %c23
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %e23)
+  ret i32 0
+}
+
@@ -0,0 +1,65 @@
+; A sum of eight loads with reassociation allowed folds into a shuffle
+; reduction. The same sum without fast-math flags keeps its order.
+; CHECK-LABEL: define float @fast(
+; CHECK: load <8 x float>
+; CHECK: %rdx.shuf = shufflevector <8 x float>
+; CHECK: fadd <8 x float>
+; CHECK: %rdx = extractelement <8 x float>
+; CHECK-LABEL: define float @strict(
+; CHECK-NOT: rdx
+; CHECK: ret float
+
+@A = global [8 x float] [float 1.0, float 2.0, float 3.0, float 4.0, float 5.0, float 6.0, float 7.0, float 8.0]
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define float @fast() {
+entry:
+  %x0 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 0)
+  %x1 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 1)
+  %x2 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 2)
+  %x3 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 3)
+  %x4 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 4)
+  %x5 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 5)
+  %x6 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 6)
+  %x7 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 7)
+  %s1 = fadd fast float %x0, %x1
+  %s2 = fadd fast float %s1, %x2
+  %s3 = fadd fast float %s2, %x3
+  %s4 = fadd fast float %s3, %x4
+  %s5 = fadd fast float %s4, %x5
+  %s6 = fadd fast float %s5, %x6
+  %s7 = fadd fast float %s6, %x7
+  ret float %s7
+}
+
+define float @strict() {
+entry:
+  %x0 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 0)
+  %x1 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 1)
+  %x2 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 2)
+  %x3 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 3)
+  %x4 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 4)
+  %x5 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 5)
+  %x6 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 6)
+  %x7 = load float, float* getelementptr ([8 x float], [8 x float]* @A, i64 0, i64 7)
+  %s1 = fadd float %x0, %x1
+  %s2 = fadd float %s1, %x2
+  %s3 = fadd float %s2, %x3
+  %s4 = fadd float %s3, %x4
+  %s5 = fadd float %s4, %x5
+  %s6 = fadd float %s5, %x6
+  %s7 = fadd float %s6, %x7
+  ret float %s7
+}
+
+define i32 @main() {
+entry:
+  %a = call float @fast()
+  %b = call float @strict()
+  %s = fadd float %a, %b
+  %i = fptosi float %s to i32
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %i)
+  ret i32 0
+}
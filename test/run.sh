@@ -0,0 +1,65 @@
+#!/bin/sh
+# Runs the SLP regression tests: every test/*.ll goes through the pass, the
+# output is matched against the file's CHECK lines with FileCheck, and when
+# the file has a main its lli output must not change. The pass also runs
+# with 1, 4 and 16 worker threads, which must print the same module.
+#
+#   SLP_DRIVER  the driver to run (default: built from slp-driver.c)
+#   SLP_LIBDIR  where libSLP is, to build the driver
+#   LLVM_CONFIG llvm-config of the LLVM the pass was built against
+#   FILECHECK, LLI  the tools, by default from llvm-config --bindir
+#
+# A test sets the pass's environment with "; ENV: VAR=value" lines, where
+# %S stands for this directory.
+
+TESTDIR=$(cd "$(dirname "$0")" && pwd)
+LLVM_CONFIG=${LLVM_CONFIG:-llvm-config}
+BINDIR=$($LLVM_CONFIG --bindir)
+FILECHECK=${FILECHECK:-$BINDIR/FileCheck}
+LLI=${LLI:-$BINDIR/lli}
+OUT=$(mktemp -d "${TMPDIR:-/tmp}/slp-test.XXXXXX")
+trap 'rm -rf "$OUT"' EXIT
+
+if [ -z "$SLP_DRIVER" ]; then
+	SLP_DRIVER=$OUT/slp-driver
+	${CC:-cc} $($LLVM_CONFIG --cflags) -o "$SLP_DRIVER" "$TESTDIR/slp-driver.c" \
+		-L"${SLP_LIBDIR:-.}" -lSLP $($LLVM_CONFIG --ldflags --libs --system-libs) || exit 1
+fi
+
+pass=0
+fail=0
+for t in "$TESTDIR"/*.ll; do
+	name=$(basename "$t" .ll)
+	env=$(sed -n 's/^; ENV: *//p' "$t" | sed "s|%S|$TESTDIR|g" | tr '\n' ' ')
+	ok=1
+	for n in 1 4 16; do
+		if ! env $env SLP_THREADS=$n "$SLP_DRIVER" "$t" "$OUT/$name.$n.ll" > "$OUT/$name.log" 2>&1; then
+			echo "FAIL $name: the pass failed with $n threads"
+			cat "$OUT/$name.log"
+			ok=0
+		elif ! cmp -s "$OUT/$name.1.ll" "$OUT/$name.$n.ll"; then
+			echo "FAIL $name: the output with $n threads differs from 1 thread"
+			diff "$OUT/$name.1.ll" "$OUT/$name.$n.ll" | head -20
+			ok=0
+		fi
+	done
+	if [ $ok = 0 ]; then
+		fail=$((fail+1))
+		continue
+	fi
+	if ! "$FILECHECK" "$t" < "$OUT/$name.1.ll"; then
+		echo "FAIL $name: CHECK lines do not match"
+		ok=0
+	elif grep -q '^define .*@main(' "$t" \
+	     && [ "$("$LLI" "$t")" != "$("$LLI" "$OUT/$name.1.ll")" ]; then
+		echo "FAIL $name: the program prints something else after SLP"
+		ok=0
+	fi
+	if [ $ok = 1 ]; then
+		pass=$((pass+1))
+	else
+		fail=$((fail+1))
+	fi
+done
+echo "$pass passed, $fail failed"
+[ $fail = 0 ]
@@ -0,0 +1,198 @@
+; A block with more independent trees than the old limit of three rounds:
+; all six are selected and vectorized, none stays scalar.
+; CHECK-LABEL: define void @six(
+; CHECK-COUNT-6: store <4 x i32>
+; CHECK-NOT: store i32
+; CHECK: ret void
+
+@A = global [8 x i32] [i32 3, i32 1, i32 4, i32 1, i32 5, i32 9, i32 2, i32 6]
+@B = global [8 x i32] [i32 2, i32 7, i32 1, i32 8, i32 2, i32 8, i32 1, i32 8]
+@R0 = global [4 x i32] zeroinitializer
+@R1 = global [4 x i32] zeroinitializer
+@R2 = global [4 x i32] zeroinitializer
+@R3 = global [4 x i32] zeroinitializer
+@R4 = global [4 x i32] zeroinitializer
+@R5 = global [4 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @six() {
+entry:
+  %a0_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %b0_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 0)
+  %r0_0 = add i32 %a0_0, %b0_0
+  store i32 %r0_0, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 0)
+  %a0_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %b0_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 1)
+  %r0_1 = add i32 %a0_1, %b0_1
+  store i32 %r0_1, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 1)
+  %a0_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %b0_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 2)
+  %r0_2 = add i32 %a0_2, %b0_2
+  store i32 %r0_2, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 2)
+  %a0_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %b0_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 3)
+  %r0_3 = add i32 %a0_3, %b0_3
+  store i32 %r0_3, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 3)
+  %a1_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 4)
+  %b1_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 0)
+  %r1_0 = sub i32 %a1_0, %b1_0
+  store i32 %r1_0, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 0)
+  %a1_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 5)
+  %b1_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 1)
+  %r1_1 = sub i32 %a1_1, %b1_1
+  store i32 %r1_1, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 1)
+  %a1_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 6)
+  %b1_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 2)
+  %r1_2 = sub i32 %a1_2, %b1_2
+  store i32 %r1_2, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 2)
+  %a1_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 7)
+  %b1_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 3)
+  %r1_3 = sub i32 %a1_3, %b1_3
+  store i32 %r1_3, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 3)
+  %a2_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %b2_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 0)
+  %r2_0 = mul i32 %a2_0, %b2_0
+  store i32 %r2_0, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 0)
+  %a2_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %b2_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 1)
+  %r2_1 = mul i32 %a2_1, %b2_1
+  store i32 %r2_1, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 1)
+  %a2_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %b2_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 2)
+  %r2_2 = mul i32 %a2_2, %b2_2
+  store i32 %r2_2, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 2)
+  %a2_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %b2_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 3)
+  %r2_3 = mul i32 %a2_3, %b2_3
+  store i32 %r2_3, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 3)
+  %a3_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 4)
+  %b3_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 4)
+  %r3_0 = xor i32 %a3_0, %b3_0
+  store i32 %r3_0, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 0)
+  %a3_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 5)
+  %b3_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 5)
+  %r3_1 = xor i32 %a3_1, %b3_1
+  store i32 %r3_1, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 1)
+  %a3_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 6)
+  %b3_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 6)
+  %r3_2 = xor i32 %a3_2, %b3_2
+  store i32 %r3_2, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 2)
+  %a3_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 7)
+  %b3_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 7)
+  %r3_3 = xor i32 %a3_3, %b3_3
+  store i32 %r3_3, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 3)
+  %a4_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %b4_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 4)
+  %r4_0 = and i32 %a4_0, %b4_0
+  store i32 %r4_0, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 0)
+  %a4_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %b4_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 5)
+  %r4_1 = and i32 %a4_1, %b4_1
+  store i32 %r4_1, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 1)
+  %a4_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %b4_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 6)
+  %r4_2 = and i32 %a4_2, %b4_2
+  store i32 %r4_2, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 2)
+  %a4_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %b4_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 7)
+  %r4_3 = and i32 %a4_3, %b4_3
+  store i32 %r4_3, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 3)
+  %a5_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 4)
+  %b5_0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 4)
+  %r5_0 = or i32 %a5_0, %b5_0
+  store i32 %r5_0, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 0)
+  %a5_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 5)
+  %b5_1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 5)
+  %r5_1 = or i32 %a5_1, %b5_1
+  store i32 %r5_1, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 1)
+  %a5_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 6)
+  %b5_2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 6)
+  %r5_2 = or i32 %a5_2, %b5_2
+  store i32 %r5_2, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 2)
+  %a5_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 7)
+  %b5_3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B, i64 0, i64 7)
+  %r5_3 = or i32 %a5_3, %b5_3
+  store i32 %r5_3, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 3)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @six()
+  %c0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 0)
+  %h0 = mul i32 0, 31
+  %e0 = add i32 %h0, %c0
+  %c1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 1)
+  %h1 = mul i32 %e0, 31
+  %e1 = add i32 %h1, %c1
+  %c2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 2)
+  %h2 = mul i32 %e1, 31
+  %e2 = add i32 %h2, %c2
+  %c3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R0, i64 0, i64 3)
+  %h3 = mul i32 %e2, 31
+  %e3 = add i32 %h3, %c3
+  %c4 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 0)
+  %h4 = mul i32 %e3, 31
+  %e4 = add i32 %h4, %c4
+  %c5 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 1)
+  %h5 = mul i32 %e4, 31
+  %e5 = add i32 %h5, %c5
+  %c6 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 2)
+  %h6 = mul i32 %e5, 31
+  %e6 = add i32 %h6, %c6
+  %c7 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R1, i64 0, i64 3)
+  %h7 = mul i32 %e6, 31
+  %e7 = add i32 %h7, %c7
+  %c8 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 0)
+  %h8 = mul i32 %e7, 31
+  %e8 = add i32 %h8, %c8
+  %c9 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 1)
+  %h9 = mul i32 %e8, 31
+  %e9 = add i32 %h9, %c9
+  %c10 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 2)
+  %h10 = mul i32 %e9, 31
+  %e10 = add i32 %h10, %c10
+  %c11 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R2, i64 0, i64 3)
+  %h11 = mul i32 %e10, 31
+  %e11 = add i32 %h11, %c11
+  %c12 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 0)
+  %h12 = mul i32 %e11, 31
+  %e12 = add i32 %h12, %c12
+  %c13 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 1)
+  %h13 = mul i32 %e12, 31
+  %e13 = add i32 %h13, %c13
+  %c14 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 2)
+  %h14 = mul i32 %e13, 31
+  %e14 = add i32 %h14, %c14
+  %c15 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R3, i64 0, i64 3)
+  %h15 = mul i32 %e14, 31
+  %e15 = add i32 %h15, %c15
+  %c16 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 0)
+  %h16 = mul i32 %e15, 31
+  %e16 = add i32 %h16, %c16
+  %c17 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 1)
+  %h17 = mul i32 %e16, 31
+  %e17 = add i32 %h17, %c17
+  %c18 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 2)
+  %h18 = mul i32 %e17, 31
+  %e18 = add i32 %h18, %c18
+  %c19 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R4, i64 0, i64 3)
+  %h19 = mul i32 %e18, 31
+  %e19 = add i32 %h19, %c19
+  %c20 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 0)
+  %h20 = mul i32 %e19, 31
+  %e20 = add i32 %h20, %c20
+  %c21 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 1)
+  %h21 = mul i32 %e20, 31
+  %e21 = add i32 %h21, %c21
+  %c22 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 2)
+  %h22 = mul i32 %e21, 31
+  %e22 = add i32 %h22, %c22
+  %c23 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @R5, i64 0, i64 3)
+  %h23 = mul i32 %e22, 31
+  %e23 = add i32 %h23, %c23
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %e23)
+  ret i32 0
+}
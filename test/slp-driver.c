@@ -0,0 +1,42 @@
+/*
+ * File: slp-driver.c
+ *
+ * Description:
+ *   Runs SLP_C on one module for the tests: reads the IR in argv[1],
+ *   verifies the result and prints it to argv[2].
+ */
+
+#include <stdio.h>
+
+#include "llvm-c/Core.h"
+#include "llvm-c/IRReader.h"
+#include "llvm-c/Analysis.h"
+
+void SLP_C(LLVMModuleRef Module);
+
+int main(int argc, char **argv)
+{
+	LLVMMemoryBufferRef Buf;
+	LLVMModuleRef Module;
+	char *err = NULL;
+	if(argc < 3){
+		fprintf(stderr,"usage: %s in.ll out.ll\n",argv[0]);
+		return 1;
+	}
+	if(LLVMCreateMemoryBufferWithContentsOfFile(argv[1],&Buf,&err)
+	   || LLVMParseIRInContext(LLVMGetGlobalContext(),Buf,&Module,&err)){
+		fprintf(stderr,"%s: %s\n",argv[1],err);
+		return 1;
+	}
+	SLP_C(Module);
+	if(LLVMVerifyModule(Module,LLVMPrintMessageAction,NULL)){
+		fprintf(stderr,"%s: module does not verify after SLP\n",argv[1]);
+		return 2;
+	}
+	if(LLVMPrintModuleToFile(Module,argv[2],&err)){
+		fprintf(stderr,"%s: %s\n",argv[2],err);
+		return 1;
+	}
+	LLVMDisposeModule(Module);
+	return 0;
+}
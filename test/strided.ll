@@ -0,0 +1,48 @@
+; The x and y fields of four {x,y} records are strided accesses: both load
+; as one contiguous span and shuffles pick out the x and the y lanes.
+; CHECK-LABEL: define void @fields(
+; CHECK: %v.span = load <8 x i32>
+; CHECK: shufflevector <8 x i32> %v.span
+; CHECK: store <4 x i32>
+
+%struct.P = type { i32, i32 }
+@P = global [4 x %struct.P] [%struct.P { i32 1, i32 2 }, %struct.P { i32 3, i32 4 }, %struct.P { i32 5, i32 6 }, %struct.P { i32 7, i32 8 }]
+@D = global [4 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @fields() {
+entry:
+  %x0 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 0, i32 0)
+  %y0 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 0, i32 1)
+  %m0 = mul i32 %x0, %y0
+  store i32 %m0, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 0)
+  %x1 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 1, i32 0)
+  %y1 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 1, i32 1)
+  %m1 = mul i32 %x1, %y1
+  store i32 %m1, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 1)
+  %x2 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 2, i32 0)
+  %y2 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 2, i32 1)
+  %m2 = mul i32 %x2, %y2
+  store i32 %m2, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 2)
+  %x3 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 3, i32 0)
+  %y3 = load i32, i32* getelementptr ([4 x %struct.P], [4 x %struct.P]* @P, i64 0, i64 3, i32 1)
+  %m3 = mul i32 %x3, %y3
+  store i32 %m3, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 3)
+  ret void
+}
+
+define i32 @main() {
+entry:
+  call void @fields()
+  %d0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 0)
+  %d1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 1)
+  %d2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 2)
+  %d3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @D, i64 0, i64 3)
+  %s1 = add i32 %d0, %d1
+  %s2 = add i32 %s1, %d2
+  %s3 = add i32 %s2, %d3
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %s3)
+  ret i32 0
+}
@@ -0,0 +1,1867 @@
+; Twenty functions of different sizes, so the worker threads finish them
+; out of order. run.sh checks the output is the same with 1, 4 and 16 threads.
+; CHECK-LABEL: define void @f0(
+; CHECK: store <4 x i32>
+; CHECK-LABEL: define void @f19(
+; CHECK: store <4 x i32>
+
+@A0 = global [8 x i32] zeroinitializer
+@B0 = global [8 x i32] zeroinitializer
+@A1 = global [16 x i32] zeroinitializer
+@B1 = global [16 x i32] zeroinitializer
+@A2 = global [32 x i32] zeroinitializer
+@B2 = global [32 x i32] zeroinitializer
+@A3 = global [8 x i32] zeroinitializer
+@B3 = global [8 x i32] zeroinitializer
+@A4 = global [8 x i32] zeroinitializer
+@B4 = global [8 x i32] zeroinitializer
+@A5 = global [4 x i32] zeroinitializer
+@B5 = global [4 x i32] zeroinitializer
+@A6 = global [4 x i32] zeroinitializer
+@B6 = global [4 x i32] zeroinitializer
+@A7 = global [8 x i32] zeroinitializer
+@B7 = global [8 x i32] zeroinitializer
+@A8 = global [8 x i32] zeroinitializer
+@B8 = global [8 x i32] zeroinitializer
+@A9 = global [8 x i32] zeroinitializer
+@B9 = global [8 x i32] zeroinitializer
+@A10 = global [32 x i32] zeroinitializer
+@B10 = global [32 x i32] zeroinitializer
+@A11 = global [4 x i32] zeroinitializer
+@B11 = global [4 x i32] zeroinitializer
+@A12 = global [32 x i32] zeroinitializer
+@B12 = global [32 x i32] zeroinitializer
+@A13 = global [32 x i32] zeroinitializer
+@B13 = global [32 x i32] zeroinitializer
+@A14 = global [32 x i32] zeroinitializer
+@B14 = global [32 x i32] zeroinitializer
+@A15 = global [32 x i32] zeroinitializer
+@B15 = global [32 x i32] zeroinitializer
+@A16 = global [32 x i32] zeroinitializer
+@B16 = global [32 x i32] zeroinitializer
+@A17 = global [8 x i32] zeroinitializer
+@B17 = global [8 x i32] zeroinitializer
+@A18 = global [32 x i32] zeroinitializer
+@B18 = global [32 x i32] zeroinitializer
+@A19 = global [4 x i32] zeroinitializer
+@B19 = global [4 x i32] zeroinitializer
+
+define void @f0() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B0, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([8 x i32], [8 x i32]* @A0, i64 0, i64 7)
+  ret void
+}
+
+define void @f1() {
+entry:
+  %a0 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([16 x i32], [16 x i32]* @B1, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([16 x i32], [16 x i32]* @A1, i64 0, i64 15)
+  ret void
+}
+
+define void @f2() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B2, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A2, i64 0, i64 31)
+  ret void
+}
+
+define void @f3() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B3, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([8 x i32], [8 x i32]* @A3, i64 0, i64 7)
+  ret void
+}
+
+define void @f4() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B4, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([8 x i32], [8 x i32]* @A4, i64 0, i64 7)
+  ret void
+}
+
+define void @f5() {
+entry:
+  %a0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B5, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B5, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B5, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B5, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([4 x i32], [4 x i32]* @A5, i64 0, i64 3)
+  ret void
+}
+
+define void @f6() {
+entry:
+  %a0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B6, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B6, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B6, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B6, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([4 x i32], [4 x i32]* @A6, i64 0, i64 3)
+  ret void
+}
+
+define void @f7() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B7, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([8 x i32], [8 x i32]* @A7, i64 0, i64 7)
+  ret void
+}
+
+define void @f8() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B8, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([8 x i32], [8 x i32]* @A8, i64 0, i64 7)
+  ret void
+}
+
+define void @f9() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B9, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([8 x i32], [8 x i32]* @A9, i64 0, i64 7)
+  ret void
+}
+
+define void @f10() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B10, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A10, i64 0, i64 31)
+  ret void
+}
+
+define void @f11() {
+entry:
+  %a0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B11, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B11, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B11, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B11, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([4 x i32], [4 x i32]* @A11, i64 0, i64 3)
+  ret void
+}
+
+define void @f12() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B12, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A12, i64 0, i64 31)
+  ret void
+}
+
+define void @f13() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B13, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A13, i64 0, i64 31)
+  ret void
+}
+
+define void @f14() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B14, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A14, i64 0, i64 31)
+  ret void
+}
+
+define void @f15() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B15, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A15, i64 0, i64 31)
+  ret void
+}
+
+define void @f16() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B16, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A16, i64 0, i64 31)
+  ret void
+}
+
+define void @f17() {
+entry:
+  %a0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @B17, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([8 x i32], [8 x i32]* @A17, i64 0, i64 7)
+  ret void
+}
+
+define void @f18() {
+entry:
+  %a0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 3)
+  %a4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 4)
+  %b4 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 4)
+  %s4 = add i32 %a4, 5
+  %m4 = mul i32 %s4, %b4
+  store i32 %m4, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 4)
+  %a5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 5)
+  %b5 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 5)
+  %s5 = add i32 %a5, 1
+  %m5 = mul i32 %s5, %b5
+  store i32 %m5, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 5)
+  %a6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 6)
+  %b6 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 6)
+  %s6 = add i32 %a6, 2
+  %m6 = mul i32 %s6, %b6
+  store i32 %m6, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 6)
+  %a7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 7)
+  %b7 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 7)
+  %s7 = add i32 %a7, 3
+  %m7 = mul i32 %s7, %b7
+  store i32 %m7, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 7)
+  %a8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 8)
+  %b8 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 8)
+  %s8 = add i32 %a8, 4
+  %m8 = mul i32 %s8, %b8
+  store i32 %m8, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 8)
+  %a9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 9)
+  %b9 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 9)
+  %s9 = add i32 %a9, 5
+  %m9 = mul i32 %s9, %b9
+  store i32 %m9, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 9)
+  %a10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 10)
+  %b10 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 10)
+  %s10 = add i32 %a10, 1
+  %m10 = mul i32 %s10, %b10
+  store i32 %m10, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 10)
+  %a11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 11)
+  %b11 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 11)
+  %s11 = add i32 %a11, 2
+  %m11 = mul i32 %s11, %b11
+  store i32 %m11, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 11)
+  %a12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 12)
+  %b12 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 12)
+  %s12 = add i32 %a12, 3
+  %m12 = mul i32 %s12, %b12
+  store i32 %m12, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 12)
+  %a13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 13)
+  %b13 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 13)
+  %s13 = add i32 %a13, 4
+  %m13 = mul i32 %s13, %b13
+  store i32 %m13, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 13)
+  %a14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 14)
+  %b14 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 14)
+  %s14 = add i32 %a14, 5
+  %m14 = mul i32 %s14, %b14
+  store i32 %m14, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 14)
+  %a15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 15)
+  %b15 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 15)
+  %s15 = add i32 %a15, 1
+  %m15 = mul i32 %s15, %b15
+  store i32 %m15, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 15)
+  %a16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 16)
+  %b16 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 16)
+  %s16 = add i32 %a16, 2
+  %m16 = mul i32 %s16, %b16
+  store i32 %m16, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 16)
+  %a17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 17)
+  %b17 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 17)
+  %s17 = add i32 %a17, 3
+  %m17 = mul i32 %s17, %b17
+  store i32 %m17, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 17)
+  %a18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 18)
+  %b18 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 18)
+  %s18 = add i32 %a18, 4
+  %m18 = mul i32 %s18, %b18
+  store i32 %m18, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 18)
+  %a19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 19)
+  %b19 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 19)
+  %s19 = add i32 %a19, 5
+  %m19 = mul i32 %s19, %b19
+  store i32 %m19, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 19)
+  %a20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 20)
+  %b20 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 20)
+  %s20 = add i32 %a20, 1
+  %m20 = mul i32 %s20, %b20
+  store i32 %m20, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 20)
+  %a21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 21)
+  %b21 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 21)
+  %s21 = add i32 %a21, 2
+  %m21 = mul i32 %s21, %b21
+  store i32 %m21, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 21)
+  %a22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 22)
+  %b22 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 22)
+  %s22 = add i32 %a22, 3
+  %m22 = mul i32 %s22, %b22
+  store i32 %m22, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 22)
+  %a23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 23)
+  %b23 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 23)
+  %s23 = add i32 %a23, 4
+  %m23 = mul i32 %s23, %b23
+  store i32 %m23, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 23)
+  %a24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 24)
+  %b24 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 24)
+  %s24 = add i32 %a24, 5
+  %m24 = mul i32 %s24, %b24
+  store i32 %m24, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 24)
+  %a25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 25)
+  %b25 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 25)
+  %s25 = add i32 %a25, 1
+  %m25 = mul i32 %s25, %b25
+  store i32 %m25, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 25)
+  %a26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 26)
+  %b26 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 26)
+  %s26 = add i32 %a26, 2
+  %m26 = mul i32 %s26, %b26
+  store i32 %m26, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 26)
+  %a27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 27)
+  %b27 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 27)
+  %s27 = add i32 %a27, 3
+  %m27 = mul i32 %s27, %b27
+  store i32 %m27, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 27)
+  %a28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 28)
+  %b28 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 28)
+  %s28 = add i32 %a28, 4
+  %m28 = mul i32 %s28, %b28
+  store i32 %m28, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 28)
+  %a29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 29)
+  %b29 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 29)
+  %s29 = add i32 %a29, 5
+  %m29 = mul i32 %s29, %b29
+  store i32 %m29, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 29)
+  %a30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 30)
+  %b30 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 30)
+  %s30 = add i32 %a30, 1
+  %m30 = mul i32 %s30, %b30
+  store i32 %m30, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 30)
+  %a31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 31)
+  %b31 = load i32, i32* getelementptr ([32 x i32], [32 x i32]* @B18, i64 0, i64 31)
+  %s31 = add i32 %a31, 2
+  %m31 = mul i32 %s31, %b31
+  store i32 %m31, i32* getelementptr ([32 x i32], [32 x i32]* @A18, i64 0, i64 31)
+  ret void
+}
+
+define void @f19() {
+entry:
+  %a0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 0)
+  %b0 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B19, i64 0, i64 0)
+  %s0 = add i32 %a0, 1
+  %m0 = mul i32 %s0, %b0
+  store i32 %m0, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 0)
+  %a1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 1)
+  %b1 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B19, i64 0, i64 1)
+  %s1 = add i32 %a1, 2
+  %m1 = mul i32 %s1, %b1
+  store i32 %m1, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 1)
+  %a2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 2)
+  %b2 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B19, i64 0, i64 2)
+  %s2 = add i32 %a2, 3
+  %m2 = mul i32 %s2, %b2
+  store i32 %m2, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 2)
+  %a3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 3)
+  %b3 = load i32, i32* getelementptr ([4 x i32], [4 x i32]* @B19, i64 0, i64 3)
+  %s3 = add i32 %a3, 4
+  %m3 = mul i32 %s3, %b3
+  store i32 %m3, i32* getelementptr ([4 x i32], [4 x i32]* @A19, i64 0, i64 3)
+  ret void
+}
@@ -0,0 +1,139 @@
+; A tree is cut where a subtree costs more than gathering its lanes. In @core
+; the loads, shifts, adds and stores are packed while the xor, or and mul
+; lanes over scattered arguments stay scalar and are gathered into the add.
+; @leaf is only that subtree under its stores, which does not pay off at all
+; and stays scalar.
+; CHECK-LABEL: define void @core(
+; CHECK: load <4 x i32>
+; CHECK: shl <4 x i32>
+; CHECK: %w3 = mul i32
+; CHECK: insertelement <4 x i32> undef, i32 %w0
+; CHECK: add <4 x i32>
+; CHECK: store <4 x i32>
+; CHECK-LABEL: define void @leaf(
+; CHECK-NOT: <4 x i32>
+; CHECK: ret void
+
+@A = global [8 x i32] [i32 3, i32 5, i32 7, i32 11, i32 13, i32 17, i32 19, i32 23]
+@C = global [8 x i32] zeroinitializer
+@D = global [8 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define void @core(i32 %a0, i32 %b0, i32 %c0, i32 %d0, i32 %a1, i32 %b1, i32 %c1, i32 %d1, i32 %a2, i32 %b2, i32 %c2, i32 %d2, i32 %a3, i32 %b3, i32 %c3, i32 %d3) {
+entry:
+  %x0 = xor i32 %a0, %b0
+  %y0 = xor i32 %c0, %d0
+  %z0 = or i32 %x0, %y0
+  %w0 = mul i32 %z0, %x0
+  %l0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 0)
+  %m0 = shl i32 %l0, 2
+  %s0 = add i32 %m0, %w0
+  store i32 %s0, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %x1 = xor i32 %a1, %b1
+  %y1 = xor i32 %c1, %d1
+  %z1 = or i32 %x1, %y1
+  %w1 = mul i32 %z1, %x1
+  %l1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 1)
+  %m1 = shl i32 %l1, 2
+  %s1 = add i32 %m1, %w1
+  store i32 %s1, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %x2 = xor i32 %a2, %b2
+  %y2 = xor i32 %c2, %d2
+  %z2 = or i32 %x2, %y2
+  %w2 = mul i32 %z2, %x2
+  %l2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 2)
+  %m2 = shl i32 %l2, 2
+  %s2 = add i32 %m2, %w2
+  store i32 %s2, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %x3 = xor i32 %a3, %b3
+  %y3 = xor i32 %c3, %d3
+  %z3 = or i32 %x3, %y3
+  %w3 = mul i32 %z3, %x3
+  %l3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @A, i64 0, i64 3)
+  %m3 = shl i32 %l3, 2
+  %s3 = add i32 %m3, %w3
+  store i32 %s3, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  ret void
+}
+define void @leaf(i32 %a0, i32 %b0, i32 %c0, i32 %d0, i32 %a1, i32 %b1, i32 %c1, i32 %d1, i32 %a2, i32 %b2, i32 %c2, i32 %d2, i32 %a3, i32 %b3, i32 %c3, i32 %d3) {
+entry:
+  %x0 = xor i32 %a0, %b0
+  %y0 = xor i32 %c0, %d0
+  %z0 = or i32 %x0, %y0
+  %w0 = mul i32 %z0, %x0
+  store i32 %w0, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %x1 = xor i32 %a1, %b1
+  %y1 = xor i32 %c1, %d1
+  %z1 = or i32 %x1, %y1
+  %w1 = mul i32 %z1, %x1
+  store i32 %w1, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %x2 = xor i32 %a2, %b2
+  %y2 = xor i32 %c2, %d2
+  %z2 = or i32 %x2, %y2
+  %w2 = mul i32 %z2, %x2
+  store i32 %w2, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %x3 = xor i32 %a3, %b3
+  %y3 = xor i32 %c3, %d3
+  %z3 = or i32 %x3, %y3
+  %w3 = mul i32 %z3, %x3
+  store i32 %w3, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  ret void
+}
+define i32 @main() {
+entry:
+  call void @core(i32 1, i32 8, i32 15, i32 22, i32 29, i32 36, i32 43, i32 50, i32 57, i32 64, i32 71, i32 78, i32 85, i32 92, i32 99, i32 106)
+  call void @leaf(i32 1, i32 8, i32 15, i32 22, i32 29, i32 36, i32 43, i32 50, i32 57, i32 64, i32 71, i32 78, i32 85, i32 92, i32 99, i32 106)
+  %c0 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 0)
+  %h0 = mul i32 0, 31
+  %e0 = add i32 %h0, %c0
+  %c1 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 1)
+  %h1 = mul i32 %e0, 31
+  %e1 = add i32 %h1, %c1
+  %c2 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 2)
+  %h2 = mul i32 %e1, 31
+  %e2 = add i32 %h2, %c2
+  %c3 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 3)
+  %h3 = mul i32 %e2, 31
+  %e3 = add i32 %h3, %c3
+  %c4 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 4)
+  %h4 = mul i32 %e3, 31
+  %e4 = add i32 %h4, %c4
+  %c5 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 5)
+  %h5 = mul i32 %e4, 31
+  %e5 = add i32 %h5, %c5
+  %c6 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 6)
+  %h6 = mul i32 %e5, 31
+  %e6 = add i32 %h6, %c6
+  %c7 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @C, i64 0, i64 7)
+  %h7 = mul i32 %e6, 31
+  %e7 = add i32 %h7, %c7
+  %c8 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 0)
+  %h8 = mul i32 %e7, 31
+  %e8 = add i32 %h8, %c8
+  %c9 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 1)
+  %h9 = mul i32 %e8, 31
+  %e9 = add i32 %h9, %c9
+  %c10 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 2)
+  %h10 = mul i32 %e9, 31
+  %e10 = add i32 %h10, %c10
+  %c11 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 3)
+  %h11 = mul i32 %e10, 31
+  %e11 = add i32 %h11, %c11
+  %c12 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 4)
+  %h12 = mul i32 %e11, 31
+  %e12 = add i32 %h12, %c12
+  %c13 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 5)
+  %h13 = mul i32 %e12, 31
+  %e13 = add i32 %h13, %c13
+  %c14 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 6)
+  %h14 = mul i32 %e13, 31
+  %e14 = add i32 %h14, %c14
+  %c15 = load i32, i32* getelementptr ([8 x i32], [8 x i32]* @D, i64 0, i64 7)
+  %h15 = mul i32 %e14, 31
+  %e15 = add i32 %h15, %c15
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %e15)
+  ret i32 0
+}
+
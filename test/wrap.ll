@@ -0,0 +1,87 @@
+; Loads of a[zext(i + k)] are only consecutive when i + k can not wrap:
+; with nsw under a sext they pack, without a wrap flag they stay scalar.
+; CHECK-LABEL: define i32 @nsw(
+; CHECK: load <4 x i32>
+; CHECK-LABEL: define i32 @wraps(
+; CHECK-NOT: <4 x i32>
+; CHECK: ret i32
+
+@A = global [300 x i32] zeroinitializer
+@fmt = private constant [4 x i8] c"%d\0A\00"
+declare i32 @printf(i8*, ...)
+
+define i32 @nsw(i8 %i) {
+entry:
+  %i0 = add nsw i8 %i, 0
+  %x0 = sext i8 %i0 to i64
+  %p0 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x0
+  %l0 = load i32, i32* %p0
+  %m0 = mul i32 %l0, 3
+  %i1 = add nsw i8 %i, 1
+  %x1 = sext i8 %i1 to i64
+  %p1 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x1
+  %l1 = load i32, i32* %p1
+  %m1 = mul i32 %l1, 4
+  %i2 = add nsw i8 %i, 2
+  %x2 = sext i8 %i2 to i64
+  %p2 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x2
+  %l2 = load i32, i32* %p2
+  %m2 = mul i32 %l2, 5
+  %i3 = add nsw i8 %i, 3
+  %x3 = sext i8 %i3 to i64
+  %p3 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x3
+  %l3 = load i32, i32* %p3
+  %m3 = mul i32 %l3, 6
+  %s1 = xor i32 %m0, %m1
+  %s2 = xor i32 %m2, %m3
+  %s = add i32 %s1, %s2
+  ret i32 %s
+}
+
+define i32 @wraps(i8 %i) {
+entry:
+  %i0 = add i8 %i, 0
+  %x0 = zext i8 %i0 to i64
+  %p0 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x0
+  %l0 = load i32, i32* %p0
+  %m0 = mul i32 %l0, 3
+  %i1 = add i8 %i, 1
+  %x1 = zext i8 %i1 to i64
+  %p1 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x1
+  %l1 = load i32, i32* %p1
+  %m1 = mul i32 %l1, 4
+  %i2 = add i8 %i, 2
+  %x2 = zext i8 %i2 to i64
+  %p2 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x2
+  %l2 = load i32, i32* %p2
+  %m2 = mul i32 %l2, 5
+  %i3 = add i8 %i, 3
+  %x3 = zext i8 %i3 to i64
+  %p3 = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %x3
+  %l3 = load i32, i32* %p3
+  %m3 = mul i32 %l3, 6
+  %s1 = xor i32 %m0, %m1
+  %s2 = xor i32 %m2, %m3
+  %s = add i32 %s1, %s2
+  ret i32 %s
+}
+
+define i32 @main() {
+entry:
+  br label %fill
+fill:
+  %j = phi i64 [ 0, %entry ], [ %j1, %fill ]
+  %p = getelementptr [300 x i32], [300 x i32]* @A, i64 0, i64 %j
+  %v = trunc i64 %j to i32
+  store i32 %v, i32* %p
+  %j1 = add i64 %j, 1
+  %done = icmp eq i64 %j1, 300
+  br i1 %done, label %run, label %fill
+run:
+  %a = call i32 @nsw(i8 40)
+  %b = call i32 @wraps(i8 254)
+  %s = add i32 %a, %b
+  %f = getelementptr [4 x i8], [4 x i8]* @fmt, i32 0, i32 0
+  call i32 (i8*, ...) @printf(i8* %f, i32 %s)
+  ret i32 0
+}